@@ -0,0 +1,92 @@
+#include "chess_engine.h"
+
+// Animação dos lances
+// Um pool fixo de ANIMATION_POOL_SIZE animações dentro do ChessGame (nenhuma
+// alocação por lance). A posição é calculada pelo tempo decorrido desde o
+// início, então quadros perdidos não atrasam nem aceleram o movimento.
+
+static float easeProgress(float t) {
+#if ANIMATION_EASING == 2
+    return t < 0.5f ? 2.0f * t * t : 1.0f - 2.0f * (1.0f - t) * (1.0f - t);  // ease-in-out
+#else
+    return t;   // linear
+#endif
+}
+
+static float animationProgress(const MoveAnimation* animation, Uint32 now) {
+    float t = (float)(now - animation->startTime) / (float)(ANIMATION_DURATION * 1000.0);
+    return t >= 1.0f ? 1.0f : t;
+}
+
+void startMoveAnimation(ChessGame* game, Piece piece, Position from, Position to) {
+#if FEATURE_ANIMATIONS
+    MoveAnimation* slot = NULL;
+
+    // Uma vaga livre ou, com o pool cheio, a animação mais antiga
+    for (int i = 0; i < ANIMATION_POOL_SIZE; i++) {
+        MoveAnimation* animation = &game->animations[i];
+        if (!animation->active) {
+            slot = animation;
+            break;
+        }
+        if (!slot || animation->startTime < slot->startTime) {
+            slot = animation;
+        }
+    }
+
+    slot->active = true;
+    slot->piece = piece;
+    slot->from = from;
+    slot->to = to;
+    slot->startTime = SDL_GetTicks();
+#else
+    (void)game;
+    (void)piece;
+    (void)from;
+    (void)to;
+#endif
+}
+
+// Encerra as animações concluídas; retorna true se ainda há alguma em
+// andamento ou se uma acabou agora (a peça no destino precisa de um quadro)
+bool updateAnimations(ChessGame* game) {
+    Uint32 now = SDL_GetTicks();
+    bool changed = false;
+
+    for (int i = 0; i < ANIMATION_POOL_SIZE; i++) {
+        MoveAnimation* animation = &game->animations[i];
+        if (!animation->active) continue;
+
+        if (animationProgress(animation, now) >= 1.0f) {
+            animation->active = false;
+        }
+        changed = true;
+    }
+    return changed;
+}
+
+bool isSquareAnimating(ChessGame* game, Position pos) {
+    for (int i = 0; i < ANIMATION_POOL_SIZE; i++) {
+        MoveAnimation* animation = &game->animations[i];
+        if (animation->active && animation->to.x == pos.x && animation->to.y == pos.y) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void drawAnimations(ChessGame* game) {
+    Uint32 now = SDL_GetTicks();
+
+    for (int i = 0; i < ANIMATION_POOL_SIZE; i++) {
+        MoveAnimation* animation = &game->animations[i];
+        if (!animation->active) continue;
+
+        float t = easeProgress(animationProgress(animation, now));
+        float x = animation->from.x + (animation->to.x - animation->from.x) * t;
+        float y = animation->from.y + (animation->to.y - animation->from.y) * t;
+        drawPieceAt(game, animation->piece,
+                    game->layout.boardX + (int)(x * game->layout.squareSize + 0.5f),
+                    game->layout.boardY + (int)(y * game->layout.squareSize + 0.5f));
+    }
+}
@@ -0,0 +1,317 @@
+#ifndef _WIN32
+#define _POSIX_C_SOURCE 200809L     // mmap, fstat e open com -std=c99
+#endif
+
+#include "chess_engine.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// Pacote de assets (make assets-pack)
+// Um único arquivo com todas as fontes, sons e imagens:
+//   cabeçalho: "MCAP", versão, 3 bytes livres, quantidade (32 bits), 4 bytes livres
+//   índice:    uma entrada por asset, ordenada pelo nome (busca binária):
+//              nome com zeros até ASSET_NAME_LENGTH, deslocamento e tamanho (32 bits)
+//   dados:     cada asset alinhado em ASSET_PACK_ALIGN bytes
+// Inteiros em little-endian. Em tempo de execução o arquivo é mapeado na
+// memória e cada asset vira um SDL_RWops sobre o próprio mapeamento, sem
+// cópia; os assets que não estão no pacote são lidos do disco como antes.
+
+typedef struct {
+    const unsigned char* data;  // Início do mapeamento
+    size_t size;
+    Uint32 count;
+#ifdef _WIN32
+    HANDLE file;
+    HANDLE mapping;
+#endif
+} AssetPack;
+
+static AssetPack pack;
+
+static Uint32 readLE32(const unsigned char* bytes) {
+    return (Uint32)bytes[0] | ((Uint32)bytes[1] << 8) |
+           ((Uint32)bytes[2] << 16) | ((Uint32)bytes[3] << 24);
+}
+
+static void writeLE32(unsigned char* bytes, Uint32 value) {
+    bytes[0] = (unsigned char)(value & 0xFF);
+    bytes[1] = (unsigned char)((value >> 8) & 0xFF);
+    bytes[2] = (unsigned char)((value >> 16) & 0xFF);
+    bytes[3] = (unsigned char)((value >> 24) & 0xFF);
+}
+
+static const unsigned char* packEntry(Uint32 index) {
+    return pack.data + ASSET_PACK_HEADER_SIZE + (size_t)index * ASSET_PACK_ENTRY_SIZE;
+}
+
+static void unmapPack(void) {
+#ifdef _WIN32
+    if (pack.data) UnmapViewOfFile(pack.data);
+    if (pack.mapping) CloseHandle(pack.mapping);
+    if (pack.file && pack.file != INVALID_HANDLE_VALUE) CloseHandle(pack.file);
+#else
+    if (pack.data) munmap((void*)pack.data, pack.size);
+#endif
+    memset(&pack, 0, sizeof(pack));
+}
+
+static bool mapPack(const char* path) {
+#ifdef _WIN32
+    pack.file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING,
+                            FILE_ATTRIBUTE_NORMAL, NULL);
+    if (pack.file == INVALID_HANDLE_VALUE) {
+        pack.file = NULL;
+        return false;
+    }
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(pack.file, &size) || size.QuadPart == 0) {
+        return false;
+    }
+    pack.size = (size_t)size.QuadPart;
+    pack.mapping = CreateFileMappingA(pack.file, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (!pack.mapping) {
+        return false;
+    }
+    pack.data = (const unsigned char*)MapViewOfFile(pack.mapping, FILE_MAP_READ, 0, 0, 0);
+    return pack.data != NULL;
+#else
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+
+    struct stat info;
+    if (fstat(fd, &info) != 0 || info.st_size == 0) {
+        close(fd);
+        return false;
+    }
+
+    void* data = mmap(NULL, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);      // O mapeamento continua válido sem o descritor
+    if (data == MAP_FAILED) {
+        return false;
+    }
+    pack.data = (const unsigned char*)data;
+    pack.size = (size_t)info.st_size;
+    return true;
+#endif
+}
+
+// Confere cabeçalho, limites e ordem do índice antes de confiar no arquivo
+static bool validatePack(void) {
+    if (pack.size < ASSET_PACK_HEADER_SIZE || memcmp(pack.data, "MCAP", 4) != 0 ||
+        pack.data[4] != ASSET_PACK_VERSION) {
+        return false;
+    }
+
+    pack.count = readLE32(pack.data + 8);
+    if (pack.count > (pack.size - ASSET_PACK_HEADER_SIZE) / ASSET_PACK_ENTRY_SIZE) {
+        return false;
+    }
+
+    for (Uint32 i = 0; i < pack.count; i++) {
+        const unsigned char* entry = packEntry(i);
+        Uint32 offset = readLE32(entry + ASSET_NAME_LENGTH);
+        Uint32 size = readLE32(entry + ASSET_NAME_LENGTH + 4);
+
+        if (entry[ASSET_NAME_LENGTH - 1] != '\0' || offset > pack.size || size > pack.size - offset) {
+            return false;
+        }
+        if (i > 0 && strcmp((const char*)packEntry(i - 1), (const char*)entry) >= 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Mapeia o pacote; sem ele (ou com ele inválido) os assets vêm do disco
+bool openAssetPack(const char* path) {
+    closeAssetPack();
+
+    if (!mapPack(path)) {
+        unmapPack();
+        return false;
+    }
+    if (!validatePack()) {
+        LOG_WARN("Pacote de assets inválido: %s", path);
+        unmapPack();
+        return false;
+    }
+    return true;
+}
+
+// Só depois de fechar fontes e músicas: elas leem direto do mapeamento
+void closeAssetPack(void) {
+    unmapPack();
+}
+
+bool findPackedAsset(const char* name, const void** data, size_t* size) {
+    Uint32 low = 0;
+    Uint32 high = pack.count;
+
+    while (low < high) {
+        Uint32 middle = low + (high - low) / 2;
+        const unsigned char* entry = packEntry(middle);
+        int order = strcmp(name, (const char*)entry);
+
+        if (order == 0) {
+            *data = pack.data + readLE32(entry + ASSET_NAME_LENGTH);
+            *size = readLE32(entry + ASSET_NAME_LENGTH + 4);
+            return true;
+        }
+        if (order < 0) {
+            high = middle;
+        } else {
+            low = middle + 1;
+        }
+    }
+    return false;
+}
+
+// Abre um asset pelo caminho relativo (ex.: "assets/fonts/arial.ttf"),
+// primeiro no pacote e depois no disco. O chamador passa o SDL_RWops para
+// as funções *_RW com freesrc = 1.
+SDL_RWops* openAsset(const char* name) {
+    const void* data;
+    size_t size;
+
+    if (findPackedAsset(name, &data, &size)) {
+        return SDL_RWFromConstMem(data, (int)size);
+    }
+    return SDL_RWFromFile(name, "rb");
+}
+
+// Ordem do índice: qsort sobre os nomes já normalizados
+static int compareNames(const void* a, const void* b) {
+    return strcmp(*(char* const*)a, *(char* const*)b);
+}
+
+static bool copyFileData(FILE* output, const char* path, long size) {
+    unsigned char buffer[16384];
+    FILE* input = fopen(path, "rb");
+    if (!input) {
+        return false;
+    }
+
+    long remaining = size;
+    while (remaining > 0) {
+        size_t chunk = remaining < (long)sizeof(buffer) ? (size_t)remaining : sizeof(buffer);
+        if (fread(buffer, 1, chunk, input) != chunk || fwrite(buffer, 1, chunk, output) != chunk) {
+            fclose(input);
+            return false;
+        }
+        remaining -= (long)chunk;
+    }
+    fclose(input);
+    return true;
+}
+
+// Grava o pacote com os arquivos dados; o nome de cada asset é o próprio
+// caminho, com '/' como separador
+bool writeAssetPack(const char* outputPath, const char* const files[], int count) {
+    char** names = (char**)calloc((size_t)(count > 0 ? count : 1), sizeof(char*));
+    long* sizes = (long*)calloc((size_t)(count > 0 ? count : 1), sizeof(long));
+    unsigned char* index = (unsigned char*)calloc((size_t)(count > 0 ? count : 1), ASSET_PACK_ENTRY_SIZE);
+    FILE* output = NULL;
+    bool ok = names && sizes && index;
+
+    for (int i = 0; ok && i < count; i++) {
+        size_t length = strlen(files[i]);
+        if (length >= ASSET_NAME_LENGTH) {
+            printf("Nome longo demais para o pacote: %s\n", files[i]);
+            ok = false;
+            break;
+        }
+        names[i] = (char*)malloc(length + 1);
+        if (!names[i]) {
+            ok = false;
+            break;
+        }
+        for (size_t c = 0; c <= length; c++) {
+            names[i][c] = files[i][c] == '\\' ? '/' : files[i][c];
+        }
+    }
+    if (ok) {
+        qsort(names, (size_t)count, sizeof(char*), compareNames);
+    }
+
+    // Tamanhos e deslocamentos (o índice inteiro vem antes dos dados)
+    Uint64 offset = ASSET_PACK_HEADER_SIZE + (Uint64)count * ASSET_PACK_ENTRY_SIZE;
+    for (int i = 0; ok && i < count; i++) {
+        if (i > 0 && strcmp(names[i - 1], names[i]) == 0) {
+            printf("Asset repetido: %s\n", names[i]);
+            ok = false;
+            break;
+        }
+
+        FILE* input = fopen(names[i], "rb");
+        if (!input || fseek(input, 0, SEEK_END) != 0 || (sizes[i] = ftell(input)) < 0) {
+            printf("Erro ao ler %s\n", names[i]);
+            if (input) fclose(input);
+            ok = false;
+            break;
+        }
+        fclose(input);
+
+        offset = (offset + ASSET_PACK_ALIGN - 1) / ASSET_PACK_ALIGN * ASSET_PACK_ALIGN;
+        unsigned char* entry = index + (size_t)i * ASSET_PACK_ENTRY_SIZE;
+        strcpy((char*)entry, names[i]);
+        writeLE32(entry + ASSET_NAME_LENGTH, (Uint32)offset);
+        writeLE32(entry + ASSET_NAME_LENGTH + 4, (Uint32)sizes[i]);
+        offset += (Uint64)sizes[i];
+        if (offset > 0xFFFFFFFFu) {
+            printf("Pacote maior que 4 GB\n");
+            ok = false;
+        }
+    }
+
+    if (ok) {
+        output = fopen(outputPath, "wb");
+        ok = output != NULL;
+        if (!ok) {
+            printf("Erro ao criar %s\n", outputPath);
+        }
+    }
+
+    if (ok) {
+        unsigned char header[ASSET_PACK_HEADER_SIZE] = {'M', 'C', 'A', 'P', ASSET_PACK_VERSION};
+        writeLE32(header + 8, (Uint32)count);
+        ok = fwrite(header, 1, sizeof(header), output) == sizeof(header) &&
+             fwrite(index, ASSET_PACK_ENTRY_SIZE, (size_t)count, output) == (size_t)count;
+    }
+
+    for (int i = 0; ok && i < count; i++) {
+        static const unsigned char padding[ASSET_PACK_ALIGN];
+        long position = ftell(output);
+        long aligned = (long)readLE32(index + (size_t)i * ASSET_PACK_ENTRY_SIZE + ASSET_NAME_LENGTH);
+
+        ok = position >= 0 && position <= aligned &&
+             fwrite(padding, 1, (size_t)(aligned - position), output) == (size_t)(aligned - position) &&
+             copyFileData(output, names[i], sizes[i]);
+        if (!ok) {
+            printf("Erro ao gravar %s no pacote\n", names[i]);
+        }
+    }
+
+    if (output && fclose(output) != 0) {
+        ok = false;
+    }
+    if (!ok && output) {
+        remove(outputPath);
+    }
+
+    for (int i = 0; names && i < count; i++) {
+        free(names[i]);
+    }
+    free(names);
+    free(sizes);
+    free(index);
+    return ok;
+}
@@ -0,0 +1,207 @@
+#include "chess_engine.h"
+
+// Carregamento de assets em segundo plano
+// Fontes, sons e música são abertos e decodificados numa thread própria para
+// que o primeiro quadro do menu apareça logo (com a fonte embutida). Cada
+// asset pronto entra numa fila circular sem trava (um produtor, um
+// consumidor); o laço principal esvazia a fila a cada quadro e faz na thread
+// de renderização só o que depende do renderer (atlas das peças, texturas
+// de texto). Os arquivos vêm do pacote mapeado quando ele existe.
+
+#define ASSET_QUEUE_SIZE 8
+
+typedef enum {
+    ASSET_FONTS,
+    ASSET_MUSIC,
+    ASSET_MOVE_SOUND,
+    ASSET_CAPTURE_SOUND,
+    ASSET_DONE
+} AssetKind;
+
+typedef struct {
+    AssetKind kind;
+    TTF_Font* font;
+    TTF_Font* bigFont;
+    int fontSize;
+    int bigFontSize;
+    const char* fontPath;
+    Mix_Chunk* chunk;
+    Mix_Music* music;
+} AssetResult;
+
+typedef struct {
+    int fontSize;
+    int bigFontSize;
+    bool audio;             // Mix_OpenAudio deu certo
+} AssetRequest;
+
+static const char* fontPaths[] = {
+    "assets/fonts/arial.ttf",
+    "C:/Windows/Fonts/arial.ttf"    // Fonte padrão do sistema (Windows)
+};
+
+static AssetResult queue[ASSET_QUEUE_SIZE];
+static SDL_atomic_t queueHead;      // Próximo a ler (só o laço principal escreve)
+static SDL_atomic_t queueTail;      // Próximo a escrever (só o carregador escreve)
+static SDL_Thread* loaderThread = NULL;
+static AssetRequest request;
+
+static void pushResult(const AssetResult* result) {
+    int tail = SDL_AtomicGet(&queueTail);
+
+    // Fila cheia: esperar o laço principal consumir (não acontece com os
+    // poucos assets atuais, mas a fila não pode sobrescrever)
+    while (tail - SDL_AtomicGet(&queueHead) >= ASSET_QUEUE_SIZE) {
+        SDL_Delay(1);
+    }
+
+    queue[tail % ASSET_QUEUE_SIZE] = *result;
+    SDL_MemoryBarrierRelease();     // O item fica visível antes do novo fim
+    SDL_AtomicSet(&queueTail, tail + 1);
+}
+
+static bool popResult(AssetResult* result) {
+    int head = SDL_AtomicGet(&queueHead);
+    if (head == SDL_AtomicGet(&queueTail)) {
+        return false;
+    }
+
+    SDL_MemoryBarrierAcquire();
+    *result = queue[head % ASSET_QUEUE_SIZE];
+    SDL_AtomicSet(&queueHead, head + 1);
+    return true;
+}
+
+static int loaderMain(void* data) {
+    AssetRequest* req = (AssetRequest*)data;
+    AssetResult result;
+
+    // Fontes: o primeiro caminho que abrir nos dois tamanhos
+    memset(&result, 0, sizeof(result));
+    result.kind = ASSET_FONTS;
+    result.fontSize = req->fontSize;
+    result.bigFontSize = req->bigFontSize;
+    for (size_t i = 0; i < sizeof(fontPaths) / sizeof(fontPaths[0]); i++) {
+        result.font = TTF_OpenFontRW(openAsset(fontPaths[i]), 1, req->fontSize);
+        result.bigFont = TTF_OpenFontRW(openAsset(fontPaths[i]), 1, req->bigFontSize);
+        if (result.font && result.bigFont) {
+            result.fontPath = fontPaths[i];
+            break;
+        }
+        if (result.font) TTF_CloseFont(result.font);
+        if (result.bigFont) TTF_CloseFont(result.bigFont);
+        result.font = result.bigFont = NULL;
+    }
+    pushResult(&result);
+
+    if (req->audio) {
+        memset(&result, 0, sizeof(result));
+        result.kind = ASSET_MUSIC;
+        result.music = Mix_LoadMUS_RW(openAsset("assets/sounds/background.wav"), 1);
+        pushResult(&result);
+
+        // Se não conseguir carregar os arquivos, sintetizar os efeitos
+        memset(&result, 0, sizeof(result));
+        result.kind = ASSET_MOVE_SOUND;
+        result.chunk = Mix_LoadWAV_RW(openAsset("assets/sounds/move.wav"), 1);
+        if (!result.chunk) {
+            result.chunk = createSimpleSound(SOUND_MOVE_FREQUENCY, SOUND_DURATION); // Nota Lá
+        }
+        pushResult(&result);
+
+        memset(&result, 0, sizeof(result));
+        result.kind = ASSET_CAPTURE_SOUND;
+        result.chunk = Mix_LoadWAV_RW(openAsset("assets/sounds/capture.wav"), 1);
+        if (!result.chunk) {
+            result.chunk = createSimpleSound(SOUND_CAPTURE_FREQUENCY, 2 * SOUND_DURATION); // Nota Lá oitava
+        }
+        pushResult(&result);
+    }
+
+    memset(&result, 0, sizeof(result));
+    result.kind = ASSET_DONE;
+    pushResult(&result);
+    return 0;
+}
+
+// Dispara o carregador; audioReady diz se o dispositivo de áudio foi aberto
+bool startAssetLoader(ChessGame* game, bool audioReady) {
+    request.fontSize = game->layout.fontSize;
+    request.bigFontSize = game->layout.bigFontSize;
+    request.audio = audioReady;
+    SDL_AtomicSet(&queueHead, 0);
+    SDL_AtomicSet(&queueTail, 0);
+
+    loaderThread = SDL_CreateThread(loaderMain, "assets", &request);
+    if (!loaderThread) {
+        // Sem thread: carregar aqui mesmo e entregar tudo de uma vez
+        LOG_ERROR("Erro ao criar thread de assets: %s", SDL_GetError());
+        loaderMain(&request);
+    }
+    return true;
+}
+
+static void applyResult(ChessGame* game, AssetResult* result) {
+    switch (result->kind) {
+        case ASSET_FONTS:
+            if (!result->font) {
+                LOG_WARN("Erro ao carregar fontes. Usando fonte embutida.");
+                break;
+            }
+            game->font = result->font;
+            game->bigFont = result->bigFont;
+            game->fontPath = result->fontPath;
+
+            // A janela pode ter mudado de escala enquanto a fonte carregava
+            if (result->fontSize != game->layout.fontSize ||
+                result->bigFontSize != game->layout.bigFontSize) {
+                openFonts(game);
+            }
+
+            // Refazer na thread de renderização o que usa a fonte
+            clearTextCache();
+            destroyPieceAtlas(game);
+            break;
+        case ASSET_MUSIC:
+            game->backgroundMusic = result->music;
+            break;
+        case ASSET_MOVE_SOUND:
+            game->moveSound = result->chunk;
+            break;
+        case ASSET_CAPTURE_SOUND:
+            game->captureSound = result->chunk;
+            break;
+        case ASSET_DONE:
+            if (loaderThread) {
+                SDL_WaitThread(loaderThread, NULL);
+                loaderThread = NULL;
+            }
+            break;
+    }
+}
+
+// Aplica os assets que ficaram prontos; retorna true se algo mudou na tela
+bool pollAssetLoader(ChessGame* game) {
+    AssetResult result;
+    bool changed = false;
+
+    while (popResult(&result)) {
+        applyResult(game, &result);
+        changed = true;
+    }
+    return changed;
+}
+
+bool isAssetLoaderRunning(void) {
+    return loaderThread != NULL;
+}
+
+// Espera o carregador terminar (saída do jogo antes do fim do carregamento)
+void finishAssetLoader(ChessGame* game) {
+    while (loaderThread) {
+        if (!pollAssetLoader(game)) {
+            SDL_Delay(1);
+        }
+    }
+    pollAssetLoader(game);
+}
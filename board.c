@@ -16,6 +16,9 @@ void initBoard(ChessBoard* board) {
     board->isSelected = false;
     board->currentPlayer = COLOR_WHITE_PIECE;
     board->moveCount = 0;
+    board->enPassant.x = -1;
+    board->enPassant.y = -1;
+    board->halfmoveClock = 0;
     
     // Colocar peças de exemplo para demonstração
     // Torre
@@ -35,64 +38,197 @@ void initBoard(ChessBoard* board) {
     board->board[3][3].color = COLOR_WHITE_PIECE;
 }
 
-void drawBoard(ChessGame* game) {
-    // Desenhar fundo do tabuleiro
-    SDL_Rect boardRect = {100, 100, BOARD_SIZE * SQUARE_SIZE, BOARD_SIZE * SQUARE_SIZE};
-    SDL_SetRenderDrawColor(game->renderer, 139, 69, 19, 255);
-    SDL_RenderFillRect(game->renderer, &boardRect);
+// Camada estática do tabuleiro (casas e bordas) desenhada uma única vez numa
+// textura; só é refeita quando o tamanho da casa muda ou a textura é perdida
+bool buildBoardLayer(ChessGame* game, int squareSize) {
+    destroyBoardLayer(game);
+    
+    int size = BOARD_SIZE * squareSize;
+    game->boardLayer = SDL_CreateTexture(game->renderer, SDL_PIXELFORMAT_RGBA8888,
+                                         SDL_TEXTUREACCESS_TARGET, size, size);
+    if (!game->boardLayer) {
+        return false;
+    }
+    
+    SDL_Texture* previousTarget = SDL_GetRenderTarget(game->renderer);
+    if (SDL_SetRenderTarget(game->renderer, game->boardLayer) < 0) {
+        destroyBoardLayer(game);
+        return false;
+    }
+    
+    SDL_Rect light[BOARD_SIZE * BOARD_SIZE / 2];
+    SDL_Rect dark[BOARD_SIZE * BOARD_SIZE / 2];
+    SDL_Rect all[BOARD_SIZE * BOARD_SIZE];
+    int lightCount = 0, darkCount = 0;
     
-    // Desenhar quadrados
     for (int i = 0; i < BOARD_SIZE; i++) {
         for (int j = 0; j < BOARD_SIZE; j++) {
-            SDL_Color squareColor;
+            SDL_Rect rect = {i * squareSize, j * squareSize, squareSize, squareSize};
+            all[i * BOARD_SIZE + j] = rect;
             if ((i + j) % 2 == 0) {
-                squareColor = COLOR_LIGHT_BROWN;
+                light[lightCount++] = rect;
             } else {
-                squareColor = COLOR_DARK_BROWN;
+                dark[darkCount++] = rect;
             }
-            
-            // Destacar quadrado selecionado
-            if (game->board.isSelected && 
-                game->board.selected.x == i && game->board.selected.y == j) {
-                squareColor = COLOR_SELECTED;
+        }
+    }
+    
+    SDL_Color lightColor = COLOR_LIGHT_BROWN;
+    SDL_Color darkColor = COLOR_DARK_BROWN;
+    SDL_SetRenderDrawColor(game->renderer, lightColor.r, lightColor.g, lightColor.b, lightColor.a);
+    SDL_RenderFillRects(game->renderer, light, lightCount);
+    SDL_SetRenderDrawColor(game->renderer, darkColor.r, darkColor.g, darkColor.b, darkColor.a);
+    SDL_RenderFillRects(game->renderer, dark, darkCount);
+    
+    // Borda dos quadrados
+    SDL_SetRenderDrawColor(game->renderer, 0, 0, 0, 255);
+    SDL_RenderDrawRects(game->renderer, all, BOARD_SIZE * BOARD_SIZE);
+    
+    SDL_SetRenderTarget(game->renderer, previousTarget);
+    game->boardLayerSize = squareSize;
+    return true;
+}
+
+void destroyBoardLayer(ChessGame* game) {
+    if (game->boardLayer) {
+        SDL_DestroyTexture(game->boardLayer);
+        game->boardLayer = NULL;
+    }
+    game->boardLayerSize = 0;
+}
+
+void drawBoard(ChessGame* game) {
+    const Layout* layout = &game->layout;
+    SDL_Rect boardRect = {layout->boardX, layout->boardY,
+                          BOARD_SIZE * layout->squareSize, BOARD_SIZE * layout->squareSize};
+    
+    if (game->boardLayerSize == layout->squareSize || buildBoardLayer(game, layout->squareSize)) {
+        SDL_RenderCopy(game->renderer, game->boardLayer, NULL, &boardRect);
+    } else {
+        // Sem suporte a render target: desenhar as casas diretamente
+        SDL_SetRenderDrawColor(game->renderer, 139, 69, 19, 255);
+        SDL_RenderFillRect(game->renderer, &boardRect);
+        
+        for (int i = 0; i < BOARD_SIZE; i++) {
+            for (int j = 0; j < BOARD_SIZE; j++) {
+                drawSquare(game, i, j, (i + j) % 2 == 0 ? COLOR_LIGHT_BROWN : COLOR_DARK_BROWN);
             }
-            
-            drawSquare(game, i, j, squareColor);
-            
-            // Desenhar peça
+        }
+    }
+    
+    // Destacar quadrado selecionado (por baixo da peça)
+    if (!game->overlay.valid) {
+        updateMoveOverlay(game);
+    }
+    if (game->overlay.hasSelection) {
+        SDL_SetRenderDrawColor(game->renderer, COLOR_SELECTED.r, COLOR_SELECTED.g, COLOR_SELECTED.b, 255);
+        SDL_RenderFillRect(game->renderer, &game->overlay.selection);
+        SDL_SetRenderDrawColor(game->renderer, 0, 0, 0, 255);
+        SDL_RenderDrawRect(game->renderer, &game->overlay.selection);
+    }
+    
+    // Desenhar peças (as que estão em movimento são desenhadas pela animação)
+    for (int i = 0; i < BOARD_SIZE; i++) {
+        for (int j = 0; j < BOARD_SIZE; j++) {
             Piece piece = game->board.board[i][j];
-            if (piece.type != PIECE_NONE) {
+            Position pos = {i, j};
+            if (piece.type != PIECE_NONE && !isSquareAnimating(game, pos)) {
                 drawPiece(game, piece, i, j);
             }
         }
     }
+    drawAnimations(game);
+    drawParticles(game);
     
-    // Mostrar movimentos possíveis
-    if (game->showMoves && game->board.isSelected) {
-        Position moves[64];
-        int moveCount = 0;
-        getPossibleMoves(&game->board, game->board.selected, moves, &moveCount);
-        
-        for (int i = 0; i < moveCount; i++) {
-            SDL_Rect moveRect = {
-                100 + moves[i].x * SQUARE_SIZE + 5,
-                100 + moves[i].y * SQUARE_SIZE + 5,
-                SQUARE_SIZE - 10,
-                SQUARE_SIZE - 10
-            };
-            SDL_SetRenderDrawColor(game->renderer, 0, 255, 0, 100);
-            SDL_RenderFillRect(game->renderer, &moveRect);
+    // Mostrar movimentos possíveis: um lote por cor, com transparência
+    if (game->overlay.hintCount > 0 || game->overlay.captureCount > 0) {
+        SDL_SetRenderDrawBlendMode(game->renderer, SDL_BLENDMODE_BLEND);
+        SDL_SetRenderDrawColor(game->renderer, COLOR_MOVE_HINT.r, COLOR_MOVE_HINT.g, COLOR_MOVE_HINT.b, 100);
+        SDL_RenderFillRects(game->renderer, game->overlay.hints, game->overlay.hintCount);
+        SDL_SetRenderDrawColor(game->renderer, COLOR_ATTACK.r, COLOR_ATTACK.g, COLOR_ATTACK.b, 100);
+        SDL_RenderFillRects(game->renderer, game->overlay.captures, game->overlay.captureCount);
+        SDL_SetRenderDrawBlendMode(game->renderer, SDL_BLENDMODE_NONE);
+    }
+    
+    // Mostrar rota até a casa sob o mouse
+    drawRoute(game);
+}
+
+// Recalcula os destaques da seleção; chamado só quando a seleção ou o
+// tabuleiro mudam (invalidateMoveOverlay), nunca a cada quadro
+void updateMoveOverlay(ChessGame* game) {
+    MoveOverlay* overlay = &game->overlay;
+    overlay->valid = true;
+    overlay->hasSelection = game->board.isSelected;
+    overlay->hintCount = 0;
+    overlay->captureCount = 0;
+    
+    if (!game->board.isSelected) {
+        return;
+    }
+    
+    const Layout* layout = &game->layout;
+    Position selected = game->board.selected;
+    overlay->selection = getSquareRect(layout, selected.x, selected.y);
+    
+    if (!game->showMoves) {
+        return;
+    }
+    
+    Position moves[64];
+    int moveCount = 0;
+    getPossibleMoves(&game->board, selected, moves, &moveCount);
+    
+    int inset = layoutScaled(layout, 5);
+    for (int i = 0; i < moveCount; i++) {
+        SDL_Rect moveRect = getSquareRect(layout, moves[i].x, moves[i].y);
+        moveRect.x += inset;
+        moveRect.y += inset;
+        moveRect.w -= 2 * inset;
+        moveRect.h -= 2 * inset;
+        if (isPositionEmpty(&game->board, moves[i])) {
+            overlay->hints[overlay->hintCount++] = moveRect;
+        } else {
+            overlay->captures[overlay->captureCount++] = moveRect;
         }
     }
 }
 
+void invalidateMoveOverlay(ChessGame* game) {
+    game->overlay.valid = false;
+}
+
+void drawRoute(ChessGame* game) {
+    if (!game->board.isSelected || game->routeLength <= 0) {
+        return;
+    }
+    
+    const Layout* layout = &game->layout;
+    int half = layout->squareSize / 2;
+    
+    SDL_SetRenderDrawColor(game->renderer, 255, 255, 0, 255);
+    for (int i = 0; i < game->routeLength; i++) {
+        SDL_Rect from = getSquareRect(layout, game->route[i].x, game->route[i].y);
+        SDL_Rect to = getSquareRect(layout, game->route[i + 1].x, game->route[i + 1].y);
+        SDL_RenderDrawLine(game->renderer, from.x + half, from.y + half, to.x + half, to.y + half);
+    }
+    
+    // Marcar as casas intermediárias
+    int marker = layoutScaled(layout, 12);
+    for (int i = 1; i <= game->routeLength; i++) {
+        SDL_Rect square = getSquareRect(layout, game->route[i].x, game->route[i].y);
+        SDL_Rect stepRect = {
+            square.x + half - marker / 2,
+            square.y + half - marker / 2,
+            marker,
+            marker
+        };
+        SDL_RenderFillRect(game->renderer, &stepRect);
+    }
+}
+
 void drawSquare(ChessGame* game, int x, int y, SDL_Color color) {
-    SDL_Rect rect = {
-        100 + x * SQUARE_SIZE,
-        100 + y * SQUARE_SIZE,
-        SQUARE_SIZE,
-        SQUARE_SIZE
-    };
+    SDL_Rect rect = getSquareRect(&game->layout, x, y);
     
     SDL_SetRenderDrawColor(game->renderer, color.r, color.g, color.b, color.a);
     SDL_RenderFillRect(game->renderer, &rect);
@@ -102,30 +238,104 @@ void drawSquare(ChessGame* game, int x, int y, SDL_Color color) {
     SDL_RenderDrawRect(game->renderer, &rect);
 }
 
-void drawPiece(ChessGame* game, Piece piece, int x, int y) {
-    int centerX = 100 + x * SQUARE_SIZE + SQUARE_SIZE / 2;
-    int centerY = 100 + y * SQUARE_SIZE + SQUARE_SIZE / 2;
-    int radius = SQUARE_SIZE / 3;
-    
-    // Cor da peça
-    SDL_Color pieceColor = piece.color == COLOR_WHITE_PIECE ? COLOR_WHITE : COLOR_BLACK;
-    SDL_SetRenderDrawColor(game->renderer, pieceColor.r, pieceColor.g, pieceColor.b, pieceColor.a);
-    
-    // Desenhar círculo base
-    for (int i = 0; i < radius; i++) {
-        for (int j = 0; j < radius; j++) {
-            if (i * i + j * j <= radius * radius) {
-                SDL_RenderDrawPoint(game->renderer, centerX + i, centerY + j);
-                SDL_RenderDrawPoint(game->renderer, centerX - i, centerY + j);
-                SDL_RenderDrawPoint(game->renderer, centerX + i, centerY - j);
-                SDL_RenderDrawPoint(game->renderer, centerX - i, centerY - j);
+// Atlas com as 12 peças (6 tipos x 2 cores) rasterizadas uma única vez.
+// Linha 0 = brancas, linha 1 = pretas; coluna = tipo - 1.
+bool buildPieceAtlas(ChessGame* game, int squareSize) {
+    destroyPieceAtlas(game);
+    
+    SDL_Surface* atlas = SDL_CreateRGBSurfaceWithFormat(0, 6 * squareSize, 2 * squareSize,
+                                                        32, SDL_PIXELFORMAT_RGBA32);
+    if (!atlas) {
+        LOG_ERROR("Erro ao criar atlas de peças: %s", SDL_GetError());
+        return false;
+    }
+    memset(atlas->pixels, 0, (size_t)atlas->pitch * atlas->h);
+    
+    float radius = squareSize / 3.0f;
+    float center = squareSize / 2.0f;
+    
+    for (int color = 0; color < 2; color++) {
+        SDL_Color pieceColor = color == COLOR_WHITE_PIECE ? COLOR_WHITE : COLOR_BLACK;
+        SDL_Color symbolColor = color == COLOR_WHITE_PIECE ? COLOR_BLACK : COLOR_WHITE;
+        
+        for (int type = PIECE_PAWN; type <= PIECE_KING; type++) {
+            int cellX = (type - 1) * squareSize;
+            int cellY = color * squareSize;
+            
+            // Círculo base com borda suavizada (cobertura pela distância ao centro)
+            for (int y = 0; y < squareSize; y++) {
+                Uint8* row = (Uint8*)atlas->pixels + (size_t)(cellY + y) * atlas->pitch;
+                for (int x = 0; x < squareSize; x++) {
+                    float dx = x + 0.5f - center;
+                    float dy = y + 0.5f - center;
+                    float coverage = radius + 0.5f - sqrtf(dx * dx + dy * dy);
+                    if (coverage <= 0.0f) continue;
+                    if (coverage > 1.0f) coverage = 1.0f;
+                    
+                    Uint8* pixel = row + (cellX + x) * 4;
+                    pixel[0] = pieceColor.r;
+                    pixel[1] = pieceColor.g;
+                    pixel[2] = pieceColor.b;
+                    pixel[3] = (Uint8)(coverage * 255.0f);
+                }
+            }
+            
+            // Símbolo da peça centralizado sobre o círculo
+            if (game->font) {
+                SDL_Surface* symbol = TTF_RenderText_Blended(game->font, getPieceSymbol((PieceType)type),
+                                                             symbolColor);
+                if (symbol) {
+                    SDL_Rect dest = {cellX + (squareSize - symbol->w) / 2,
+                                     cellY + (squareSize - symbol->h) / 2,
+                                     symbol->w, symbol->h};
+                    SDL_BlitSurface(symbol, NULL, atlas, &dest);
+                    SDL_FreeSurface(symbol);
+                }
             }
         }
     }
     
-    // Desenhar símbolo da peça
-    SDL_Color symbolColor = piece.color == COLOR_WHITE_PIECE ? COLOR_BLACK : COLOR_WHITE;
-    drawText(game, getPieceSymbol(piece.type), centerX - 10, centerY - 10, symbolColor);
+    game->pieceAtlas = SDL_CreateTextureFromSurface(game->renderer, atlas);
+    SDL_FreeSurface(atlas);
+    if (!game->pieceAtlas) {
+        LOG_ERROR("Erro ao criar textura do atlas: %s", SDL_GetError());
+        return false;
+    }
+    
+    SDL_SetTextureBlendMode(game->pieceAtlas, SDL_BLENDMODE_BLEND);
+    game->pieceAtlasSize = squareSize;
+    return true;
+}
+
+void destroyPieceAtlas(ChessGame* game) {
+    if (game->pieceAtlas) {
+        SDL_DestroyTexture(game->pieceAtlas);
+        game->pieceAtlas = NULL;
+    }
+    game->pieceAtlasSize = 0;
+}
+
+// Desenha a peça com o canto superior esquerdo em (pixelX, pixelY)
+void drawPieceAt(ChessGame* game, Piece piece, int pixelX, int pixelY) {
+    // Re-rasterizar só quando o tamanho da casa muda
+    int size = game->layout.squareSize;
+    if (game->pieceAtlasSize != size && !buildPieceAtlas(game, size)) {
+        return;
+    }
+    
+    SDL_Rect source = {
+        (piece.type - 1) * size,
+        piece.color * size,
+        size,
+        size
+    };
+    SDL_Rect dest = {pixelX, pixelY, size, size};
+    SDL_RenderCopy(game->renderer, game->pieceAtlas, &source, &dest);
+}
+
+void drawPiece(ChessGame* game, Piece piece, int x, int y) {
+    SDL_Rect square = getSquareRect(&game->layout, x, y);
+    drawPieceAt(game, piece, square.x, square.y);
 }
 
 const char* getPieceSymbol(PieceType type) {
@@ -171,23 +381,20 @@ bool isValidMove(ChessBoard* board, Position from, Position to) {
     return false;
 }
 
+// Lance da interface: roque, en passant e promoção (sempre para dama) ficam
+// a cargo de applyMove
 void makeMove(ChessBoard* board, Position from, Position to) {
     Piece* fromPiece = getPieceAt(board, from);
     Piece* toPiece = getPieceAt(board, to);
     
     if (fromPiece && toPiece) {
-        // Mover peça
-        *toPiece = *fromPiece;
-        toPiece->pos = to;
-        toPiece->hasMoved = true;
-        
-        // Limpar posição original
-        fromPiece->type = PIECE_NONE;
-        fromPiece->color = COLOR_WHITE_PIECE;
-        fromPiece->hasMoved = false;
+        Move move = {from, to, PIECE_NONE};
+        if (fromPiece->type == PIECE_PAWN && (to.y == 0 || to.y == BOARD_SIZE - 1)) {
+            move.promotion = PIECE_QUEEN;
+        }
         
-        board->moveCount++;
-        board->currentPlayer = !board->currentPlayer;
+        MoveUndo undo;
+        applyMove(board, move, &undo);
     }
 }
 
@@ -9,23 +9,28 @@
 #include <string.h>
 #include <stdbool.h>
 #include <math.h>
+#include <stdint.h>
+#include "config.h"
 
 // Constantes do jogo
 #define BOARD_SIZE 8
-#define SQUARE_SIZE 100
+#define SQUARE_SIZE 100            // Tamanho de referência; o real vem do Layout
 #define WINDOW_WIDTH 1000
 #define WINDOW_HEIGHT 800
+#define BOARD_MARGIN 40             // Margem em volta do tabuleiro (referência)
+#define PANEL_WIDTH 160             // Largura do painel lateral (referência)
+#define PANEL_PADDING 20
 #define FPS 60
 
 // Cores modernas
-#define COLOR_WHITE {255, 255, 255, 255}
-#define COLOR_BLACK {0, 0, 0, 255}
-#define COLOR_LIGHT_BROWN {240, 217, 181, 255}
-#define COLOR_DARK_BROWN {181, 136, 99, 255}
-#define COLOR_HIGHLIGHT {255, 255, 0, 255}
-#define COLOR_MOVE_HINT {0, 255, 0, 255}
-#define COLOR_ATTACK {255, 0, 0, 255}
-#define COLOR_SELECTED {0, 0, 255, 255}
+#define COLOR_WHITE ((SDL_Color){255, 255, 255, 255})
+#define COLOR_BLACK ((SDL_Color){0, 0, 0, 255})
+#define COLOR_LIGHT_BROWN ((SDL_Color){240, 217, 181, 255})
+#define COLOR_DARK_BROWN ((SDL_Color){181, 136, 99, 255})
+#define COLOR_HIGHLIGHT ((SDL_Color){255, 255, 0, 255})
+#define COLOR_MOVE_HINT ((SDL_Color){0, 255, 0, 255})
+#define COLOR_ATTACK ((SDL_Color){255, 0, 0, 255})
+#define COLOR_SELECTED ((SDL_Color){0, 0, 255, 255})
 
 // Tipos de peças
 typedef enum {
@@ -64,8 +69,172 @@ typedef struct {
     bool isSelected;
     int currentPlayer;
     int moveCount;
+    Position enPassant;     // Casa pulada pelo último avanço duplo ({-1, -1} = nenhuma)
+    int halfmoveClock;      // Lances desde a última captura ou lance de peão
 } ChessBoard;
 
+// Lance completo (origem, destino e peça de promoção)
+#define MAX_LEGAL_MOVES 256
+
+typedef struct {
+    Position from;
+    Position to;
+    PieceType promotion;    // PIECE_NONE quando não há promoção
+} Move;
+
+// Informação necessária para desfazer um lance sem copiar o tabuleiro
+typedef struct {
+    Move move;
+    Piece moved;
+    Piece captured;
+    Position capturedAt;    // Difere do destino só na captura en passant
+    int currentPlayer;
+    int moveCount;
+    Position enPassant;
+    int halfmoveClock;
+} MoveUndo;
+
+// Situação da partida para o jogador da vez
+typedef enum {
+    GAME_IN_PROGRESS = 0,
+    GAME_CHECKMATE,
+    GAME_STALEMATE
+} GameStatus;
+
+// Visualizador passo a passo das buscas do cavalo
+#define VISUALIZER_TRACE_SIZE 256      // Eventos guardados (buffer circular)
+#define VISUALIZER_TRACE_DRAWN 32      // Eventos recentes destacados por quadro
+
+typedef enum {
+    SEARCH_RECURSIVE = 0,
+    SEARCH_MEMOIZED,
+    SEARCH_BFS,
+    SEARCH_ALGORITHM_COUNT
+} SearchAlgorithm;
+
+typedef enum {
+    TRACE_ENTER = 0,    // Casa entrou na fronteira (pilha ou fila)
+    TRACE_LEAVE,        // Casa saiu da fronteira (backtracking ou expandida)
+    TRACE_FOUND         // Caminho até o destino encontrado
+} TraceKind;
+
+typedef struct {
+    unsigned char square;
+    unsigned char kind;
+} TraceEvent;
+
+// Quadro da pilha explícita que substitui a recursão
+typedef struct {
+    unsigned char square;
+    unsigned char nextMove;
+} SearchFrame;
+
+typedef struct {
+    bool active;
+    bool finished;
+    SearchAlgorithm algorithm;
+    Position start;
+    Position target;
+    SearchFrame stack[BOARD_SIZE * BOARD_SIZE];
+    int depth;
+    unsigned char queue[BOARD_SIZE * BOARD_SIZE];
+    int queueHead;
+    int queueTail;
+    int parent[BOARD_SIZE * BOARD_SIZE];
+    int bestDepth[BOARD_SIZE * BOARD_SIZE];     // Memoização / distância da BFS
+    bool onPath[BOARD_SIZE * BOARD_SIZE];
+    unsigned char squareState[BOARD_SIZE * BOARD_SIZE];
+    unsigned char bestPath[BOARD_SIZE * BOARD_SIZE];
+    int bestMoves;                              // -1 = nenhum caminho ainda
+    long long steps;
+    int stepsPerFrame;                          // Velocidade da animação (0 = só o orçamento)
+    TraceEvent trace[VISUALIZER_TRACE_SIZE];
+    long long traceCount;
+} SearchVisualizer;
+
+// Destaques da peça selecionada, calculados só quando a seleção muda
+typedef struct {
+    bool valid;
+    bool hasSelection;
+    SDL_Rect selection;
+    SDL_Rect hints[BOARD_SIZE * BOARD_SIZE];     // Casas vazias alcançáveis
+    int hintCount;
+    SDL_Rect captures[BOARD_SIZE * BOARD_SIZE];  // Casas com peça adversária
+    int captureCount;
+} MoveOverlay;
+
+// Animação de um lance (interpolada pelo relógio, não por quadros)
+#define ANIMATION_POOL_SIZE 16
+
+typedef struct {
+    bool active;
+    Piece piece;
+    Position from;
+    Position to;
+    Uint32 startTime;       // SDL_GetTicks() no início
+} MoveAnimation;
+
+// Layout da janela, recalculado só quando ela é redimensionada (resizeLayout).
+// As medidas de referência valem para WINDOW_WIDTH x WINDOW_HEIGHT e são
+// multiplicadas por scale; desenho e mouse usam as mesmas conversões.
+typedef struct {
+    int width, height;          // Tamanho atual da janela
+    float scale;
+    int boardX, boardY;         // Canto superior esquerdo do tabuleiro
+    int squareSize;
+    int panelX, panelWidth;
+    int fontSize, bigFontSize;
+} Layout;
+
+// Partida jogada na interface: posição inicial, lances (salvar e PGN) e o
+// histórico para desfazer/refazer e detectar repetições
+typedef struct {
+    ChessBoard start;
+    Move moves[MAX_MOVES];
+    MoveUndo undo[MAX_MOVES];       // undo[i] desfaz moves[i]
+    Uint64 hashes[MAX_MOVES + 1];   // hashes[i] = posição depois de i lances
+    int count;                      // Lances jogados até a posição atual
+    int total;                      // Lances que podem ser refeitos (>= count)
+} GameRecord;
+
+// Gravação e reprodução da entrada (--record / --replay)
+#define INPUT_TRACE_VERSION 1
+#define FRAME_HISTOGRAM_BUCKETS 1000    // Tempos de quadro em passos de 0,1 ms (até 100 ms)
+
+typedef enum {
+    INPUT_TRACE_OFF = 0,
+    INPUT_TRACE_RECORD,
+    INPUT_TRACE_REPLAY
+} InputTraceMode;
+
+// Evento gravado: 16 bytes em vez dos 56 de SDL_Event
+typedef struct {
+    Uint32 time;            // ms desde o início de runGame
+    Uint16 type;            // SDL_KEYDOWN, SDL_MOUSEBUTTONDOWN, ...
+    Uint8 detail;           // Botão do mouse ou subtipo de SDL_WINDOWEVENT
+    Uint8 reserved;
+    Sint32 a, b;            // Tecla e modificadores, posição do mouse ou tamanho da janela
+} InputRecord;
+
+typedef struct {
+    long long frames;
+    double totalMs;
+    double minMs, maxMs;
+    Uint32 histogram[FRAME_HISTOGRAM_BUCKETS + 1];     // Último = acima de 100 ms
+} FrameStats;
+
+typedef struct {
+    InputTraceMode mode;
+    bool fast;              // Reprodução sem esperar os tempos gravados
+    const char* path;
+    FILE* file;
+    Uint32 startTime;
+    long long events;
+    InputRecord next;       // Próximo evento da reprodução
+    bool hasNext;
+    FrameStats stats;
+} InputTrace;
+
 // Estrutura do jogo
 typedef struct {
     SDL_Window* window;
@@ -79,8 +248,23 @@ typedef struct {
     bool running;
     bool showMoves;
     int difficulty;
-    int score;
+    int score;                  // SCORE_PER_MOVE por lance do histórico
     char playerName[50];
+    Position route[BOARD_SIZE * BOARD_SIZE];
+    int routeLength;
+    SearchVisualizer visualizer;
+    SDL_Texture* pieceAtlas;    // 12 peças pré-renderizadas
+    int pieceAtlasSize;         // Tamanho da casa usado no atlas (0 = não criado)
+    bool needsRedraw;           // Algo mudou desde o último quadro desenhado
+    SDL_Texture* boardLayer;    // Casas do tabuleiro já desenhadas
+    int boardLayerSize;         // Tamanho da casa usado na camada (0 = não criada)
+    MoveOverlay overlay;
+    MoveAnimation animations[ANIMATION_POOL_SIZE];
+    Layout layout;
+    const char* fontPath;       // Arquivo de onde as fontes foram abertas
+    GameRecord record;
+    InputTrace trace;
+    char solverStatus[64];      // Resultado da última busca de mate (tecla M no modo Mestre)
 } ChessGame;
 
 // Estrutura de menu
@@ -100,7 +284,16 @@ void runGame(ChessGame* game);
 void initBoard(ChessBoard* board);
 void drawBoard(ChessGame* game);
 void drawPiece(ChessGame* game, Piece piece, int x, int y);
+void drawPieceAt(ChessGame* game, Piece piece, int pixelX, int pixelY);
+bool buildPieceAtlas(ChessGame* game, int squareSize);
+void destroyPieceAtlas(ChessGame* game);
+bool buildBoardLayer(ChessGame* game, int squareSize);
+void destroyBoardLayer(ChessGame* game);
+void updateMoveOverlay(ChessGame* game);
+void invalidateMoveOverlay(ChessGame* game);
 void drawSquare(ChessGame* game, int x, int y, SDL_Color color);
+const char* getPieceSymbol(PieceType type);
+void handleGameInput(ChessGame* game, SDL_Event* event);
 
 // Funções de movimento
 bool isValidMove(ChessBoard* board, Position from, Position to);
@@ -115,15 +308,265 @@ void getKnightMoves(ChessBoard* board, Position pos, Position moves[], int* coun
 void getQueenMoves(ChessBoard* board, Position pos, Position moves[], int* count);
 void getKingMoves(ChessBoard* board, Position pos, Position moves[], int* count);
 
+// Funções de regras (xeque, lances legais e fim de partida)
+bool isSquareAttacked(ChessBoard* board, Position pos, PieceColor attacker);
+Position findKing(ChessBoard* board, PieceColor color);
+bool isKingInCheck(ChessBoard* board, PieceColor color);
+void applyMove(ChessBoard* board, Move move, MoveUndo* undo);
+void undoMove(ChessBoard* board, const MoveUndo* undo);
+int generateLegalMoves(ChessBoard* board, Move moves[]);
+bool isLegalMove(ChessBoard* board, Move move);
+GameStatus getGameStatus(ChessBoard* board);
+Uint64 computeBoardHash(ChessBoard* board);
+
+// Funções do pool de threads com roubo de trabalho
+#define POOL_MAX_WORKERS 64
+#define POOL_QUEUE_SIZE 1024
+
+typedef struct ThreadPool ThreadPool;
+typedef void (*PoolTask)(ThreadPool* pool, int worker, void* data);
+
+ThreadPool* createThreadPool(int workerCount);
+bool submitTask(ThreadPool* pool, int worker, PoolTask function, void* data);
+bool waitThreadPool(ThreadPool* pool, Uint32 timeoutMs);
+int getThreadPoolSize(ThreadPool* pool);
+int getThreadPoolSteals(ThreadPool* pool);
+void destroyThreadPool(ThreadPool* pool);
+
+// Funções de problemas de mate (busca de mate e arquivo de problemas)
+#define PUZZLE_FILE_VERSION 1
+#define PUZZLE_HEADER_SIZE 12
+#define PUZZLE_RECORD_SIZE 35
+
+void clearBoard(ChessBoard* board);
+bool sampleMatePosition(ChessBoard* board, Uint64* rng);
+int countMateSolutions(ChessBoard* board, int mateDepth, Move* solution, long long* nodes);
+unsigned int encodeMove(Move move);
+Move decodeMove(unsigned int code);
+void encodePuzzle(ChessBoard* board, int mateDepth, Move solution, unsigned char record[PUZZLE_RECORD_SIZE]);
+int decodePuzzle(const unsigned char record[PUZZLE_RECORD_SIZE], ChessBoard* board, Move* solution);
+bool writePuzzleHeader(FILE* file, Uint32 count);
+long readPuzzleHeader(FILE* file);
+
+// Notação padrão: FEN (posições), SAN (lances) e PGN (partidas)
+#define FEN_MAX_LENGTH 100
+#define SAN_MAX_LENGTH 16
+#define UCI_MOVE_LENGTH 6
+#define STARTING_FEN "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1"
+
+void boardToFEN(ChessBoard* board, char fen[FEN_MAX_LENGTH]);
+bool loadFEN(ChessBoard* board, const char* fen);
+void moveToSAN(ChessBoard* board, Move move, char san[SAN_MAX_LENGTH]);
+bool parseSAN(ChessBoard* board, const char* san, Move* move);
+void moveToUCI(Move move, char text[UCI_MOVE_LENGTH]);
+bool parseUCIMove(ChessBoard* board, const char* text, Move* move);
+const char* parsePGNHeader(const char* text, const char* end, ChessBoard* start);
+bool nextPGNMove(const char** cursor, const char* end, char san[SAN_MAX_LENGTH]);
+int readPGN(const char* text, size_t length, ChessBoard* start, Move moves[], int maxMoves);
+bool writePGN(FILE* file, ChessBoard* start, const Move moves[], int count, const char* white);
+
+// Histórico da partida (desfazer/refazer sem copiar o tabuleiro, repetições)
+void startGameRecord(ChessGame* game);
+bool playRecordedMove(ChessGame* game, Move move);
+bool undoRecordedMove(ChessGame* game);
+bool redoRecordedMove(ChessGame* game);
+void replayGameRecord(ChessGame* game);
+int countRepetitions(ChessGame* game);
+
+// Busca alfa-beta do frontend UCI (tabela de transposição e Lazy SMP)
+#define SEARCH_MAX_PLY 64
+#define SEARCH_MAX_THREADS (POOL_MAX_WORKERS + 1)
+#define SEARCH_MATE_SCORE 30000     // Mate em n meios-lances vale SEARCH_MATE_SCORE - n
+
+typedef struct {
+    int depth;                  // 0 = sem limite
+    long long nodes;            // 0 = sem limite
+} SearchLimits;
+
+typedef struct {
+    int depth;
+    int score;                  // Do ponto de vista do lado da vez
+    long long nodes;
+    Uint32 timeMs;
+    int hashfull;               // Por mil
+    Move pv[SEARCH_MAX_PLY];
+    int pvLength;
+} SearchInfo;
+
+typedef void (*SearchReport)(const SearchInfo* info, void* data);
+
+bool resizeSearchTable(int megabytes);
+void clearSearchTable(void);
+int getSearchHashfull(void);
+bool setSearchThreads(int count);
+void setSearchDeadline(Uint32 budgetMs);
+void setSearchStopped(bool stopped);
+Move searchBestMove(ChessBoard* board, const Uint64 history[], int historyCount,
+                    const SearchLimits* limits, SearchReport report, void* reportData, Move* ponder);
+
+// Salvar e carregar partidas (binário compacto) e importar/exportar PGN
+#define SAVE_FILE_VERSION 2
+#define SAVE_GAME_FILE SAVE_FILE_PATH "matecheck.sav"
+#define SAVE_PGN_FILE SAVE_FILE_PATH "partida.pgn"
+#define SAVE_FEN_FILE SAVE_FILE_PATH "posicao.fen"
+
+bool saveGame(ChessGame* game, const char* path);
+bool loadGame(ChessGame* game, const char* path);
+bool exportPGN(ChessGame* game, const char* pgnPath, const char* fenPath);
+bool importPGN(ChessGame* game, const char* path);
+
+// Funções do resolvedor de mates por números de prova (df-pn)
+#define DFPN_DEFAULT_TABLE_MB 16
+#define DFPN_INTERACTIVE_BUDGET_MS 300       // Tempo da busca feita na thread da interface (tecla M)
+
+typedef struct {
+    bool proven;            // Mate forçado encontrado
+    bool disproven;         // Não há mate dentro do limite de lances
+    bool aborted;           // Limite de nós ou de tempo atingido
+    Move bestMove;
+    long long nodes;
+    double seconds;
+    double nodesPerSecond;
+    long tableCapacity;
+    long peakEntries;
+    long peakBytes;
+    int gcRuns;
+} DfpnResult;
+
+bool solveMateDfpn(ChessBoard* board, int maxMoves, int tableMegabytes,
+                   long long maxNodes, Uint32 maxMilliseconds, DfpnResult* result);
+bool solveMestrePosition(ChessGame* game, int maxMoves);
+
+// Funções do visualizador de buscas (avançado um pouco a cada quadro)
+void startVisualizer(SearchVisualizer* vis, SearchAlgorithm algorithm, Position start, Position target);
+bool advanceVisualizer(SearchVisualizer* vis, int stepLimit, Uint32 budgetMs);
+void drawVisualizer(ChessGame* game);
+const char* getSearchAlgorithmName(SearchAlgorithm algorithm);
+
+// Funções de animação dos lances
+void startMoveAnimation(ChessGame* game, Piece piece, Position from, Position to);
+bool updateAnimations(ChessGame* game);
+bool isSquareAnimating(ChessGame* game, Position pos);
+void drawAnimations(ChessGame* game);
+
+// Layout independente de resolução
+void computeLayout(Layout* layout, int width, int height);
+void resizeLayout(ChessGame* game, int width, int height);
+bool openFonts(ChessGame* game);
+int layoutScaled(const Layout* layout, int value);
+SDL_Rect getSquareRect(const Layout* layout, int x, int y);
+bool screenToBoard(const Layout* layout, int pixelX, int pixelY, Position* pos);
+void drawPanelText(ChessGame* game, const char* text, int y, SDL_Color color);
+
+// Sistema de partículas (FEATURE_PARTICLES)
+void emitParticles(float x, float y, SDL_Color color, int amount, float speed);
+bool updateParticles(void);
+void drawParticles(ChessGame* game);
+int getParticleCount(void);
+void clearParticles(void);
+
+// Perfilador de quadros (HUD com gráfico e p50/p99 por estágio)
+#if ENABLE_PROFILING || DEBUG_PERFORMANCE
+#define PROFILING_ENABLED 1
+#endif
+
+#define PROFILE_HISTORY 240     // Quadros guardados no buffer circular
+
+typedef enum {
+    PROFILE_EVENTS = 0,
+    PROFILE_BOARD,
+    PROFILE_UI,
+    PROFILE_TEXT,
+    PROFILE_PRESENT,
+    PROFILE_STAGE_COUNT
+} ProfileStage;
+
+#ifdef PROFILING_ENABLED
+void profileBeginFrame(void);
+void profileEndFrame(void);
+void profileAddTime(ProfileStage stage, Uint64 ticks);
+void drawProfilerHUD(ChessGame* game);
+
+#define PROFILE_BEGIN(stage) Uint64 profileStart_##stage = SDL_GetPerformanceCounter()
+#define PROFILE_END(stage) profileAddTime(stage, SDL_GetPerformanceCounter() - profileStart_##stage)
+#define PROFILE_FRAME_BEGIN() profileBeginFrame()
+#define PROFILE_FRAME_END() profileEndFrame()
+#define PROFILE_DRAW_HUD(game) drawProfilerHUD(game)
+#else
+#define PROFILE_BEGIN(stage) ((void)0)
+#define PROFILE_END(stage) ((void)0)
+#define PROFILE_FRAME_BEGIN() ((void)0)
+#define PROFILE_FRAME_END() ((void)0)
+#define PROFILE_DRAW_HUD(game) ((void)0)
+#endif
+
+// Funções de busca de caminhos (A*)
+int findPiecePath(ChessBoard* board, PieceType type, PieceColor color,
+                  Position from, Position to, Position path[], int maxPath);
+void updateSelectedRoute(ChessGame* game, Position target);
+void drawRoute(ChessGame* game);
+
 // Funções de interface
 void drawMenu(ChessGame* game, Menu* menu);
 void handleMenuInput(ChessGame* game, Menu* menu, SDL_Event* event);
 void drawUI(ChessGame* game);
 void drawText(ChessGame* game, const char* text, int x, int y, SDL_Color color);
+void clearTextCache(void);
+void drawFallbackText(ChessGame* game, const char* text, int x, int y, SDL_Color color);
+void destroyFallbackFont(void);
+
+// Carregamento de fontes, sons e música em segundo plano
+bool startAssetLoader(ChessGame* game, bool audioReady);
+bool pollAssetLoader(ChessGame* game);
+bool isAssetLoaderRunning(void);
+void finishAssetLoader(ChessGame* game);
+
+// Pacote de assets mapeado na memória (make assets-pack)
+#define ASSET_PACK_VERSION 1
+#define ASSET_PACK_HEADER_SIZE 16
+#define ASSET_PACK_ENTRY_SIZE 64
+#define ASSET_NAME_LENGTH 56            // Nome com o zero final; + deslocamento e tamanho
+#define ASSET_PACK_ALIGN 16
+
+bool openAssetPack(const char* path);
+void closeAssetPack(void);
+bool findPackedAsset(const char* name, const void** data, size_t* size);
+SDL_RWops* openAsset(const char* name);
+bool writeAssetPack(const char* outputPath, const char* const files[], int count);
+
+// Gravação e reprodução da entrada para medições repetíveis
+bool startInputTrace(ChessGame* game);
+void recordInputEvent(ChessGame* game, const SDL_Event* event);
+bool nextReplayEvent(ChessGame* game, SDL_Event* event);
+Uint32 getReplayDelay(ChessGame* game);
+bool isReplayFinished(ChessGame* game);
+void addFrameTime(FrameStats* stats, double ms);
+void finishInputTrace(ChessGame* game);
+
+// Log assíncrono em LOG_FILE_PATH (buffer por thread, escritor em segundo
+// plano). Níveis abaixo de LOG_MIN_LEVEL somem na compilação.
+typedef enum {
+    LOG_LEVEL_DEBUG = 0,
+    LOG_LEVEL_INFO,
+    LOG_LEVEL_WARN,
+    LOG_LEVEL_ERROR
+} LogLevel;
+
+#define LOG_AT(level, ...) do { if ((level) >= LOG_MIN_LEVEL) logMessage(level, __VA_ARGS__); } while (0)
+#define LOG_DEBUG(...) LOG_AT(LOG_LEVEL_DEBUG, __VA_ARGS__)
+#define LOG_INFO(...) LOG_AT(LOG_LEVEL_INFO, __VA_ARGS__)
+#define LOG_WARN(...) LOG_AT(LOG_LEVEL_WARN, __VA_ARGS__)
+#define LOG_ERROR(...) LOG_AT(LOG_LEVEL_ERROR, __VA_ARGS__)
+
+bool startLogger(const char* path);
+void stopLogger(void);
+void logMessage(LogLevel level, const char* format, ...);
+int getDroppedLogCount(void);
 
 // Funções de áudio
 bool initAudio(ChessGame* game);
 void playSound(ChessGame* game, Mix_Chunk* sound);
+Mix_Chunk* createSimpleSound(int frequency, float duration);
 
 // Funções de utilidade
 bool isPositionValid(Position pos);
@@ -36,13 +36,25 @@
 
 // === CONFIGURAÇÕES DE JOGO ===
 #define MAX_MOVES 1000
+#define SCORE_PER_MOVE 10           // Pontos por lance jogado na interface
 #define MAX_DEPTH 10
 #define TIMEOUT_SECONDS 30
 
 // === CONFIGURAÇÕES DE PERFORMANCE ===
 #define MAX_FPS 60
 #define VSYNC_ENABLED 1
+#define IDLE_WAIT_MS 500            // Espera máxima por eventos com a tela parada
+#define ASSET_POLL_INTERVAL_MS 10   // Espera por eventos enquanto os assets carregam
 #define HARDWARE_ACCELERATION 1
+#define VISUALIZER_BUDGET_MS 4      // Tempo de busca por quadro no visualizador
+#define VISUALIZER_STEPS_PER_CHECK 64
+#define VISUALIZER_STEPS_PER_FRAME 4    // Passos por quadro (velocidade da animação)
+#define TEXT_CACHE_ENTRIES 128           // Textos renderizados mantidos em cache
+#define TEXT_CACHE_KEY_LENGTH 96         // Textos maiores não entram no cache
+#define TEXT_CACHE_MAX_BYTES (2 * 1024 * 1024)
+#define SEARCH_DEFAULT_HASH_MB 16       // Tabela de transposição do matecheck-uci
+#define SEARCH_MAX_HASH_MB 4096
+#define SEARCH_MOVE_OVERHEAD_MS 30      // Margem de comunicação por lance no relógio
 
 // === CONFIGURAÇÕES DE DEBUG ===
 #ifdef DEBUG
@@ -73,18 +85,32 @@
 
 // === CONFIGURAÇÕES DE ANIMAÇÃO ===
 #define ANIMATION_DURATION 0.3      // 300ms
-#define ANIMATION_FRAMES 10
+#define ANIMATION_FRAMES 10         // Só referência: a animação segue o relógio, não quadros
 #define ANIMATION_EASING 1          // 1 = linear, 2 = ease-in-out
+#define PARTICLE_CAPACITY 4096      // Tamanho fixo do pool de partículas
+#define PARTICLES_CAPTURE 120       // Partículas por captura
+#define PARTICLES_PROMOTION 200     // Partículas por promoção
+#define PARTICLES_MATE 1500         // Partículas no xeque-mate
 
 // === CONFIGURAÇÕES DE ARQUIVOS ===
 #define SAVE_FILE_PATH "saves/"
 #define CONFIG_FILE_PATH "config.ini"
 #define LOG_FILE_PATH "logs/matecheck.log"
+#define LOG_MIN_LEVEL (DEBUG_LOGGING ? LOG_LEVEL_DEBUG : LOG_LEVEL_INFO)
+#define LOG_MAX_THREADS 16          // Threads com buffer de log próprio
+#define LOG_RING_ENTRIES 256        // Mensagens por buffer (potência de 2)
+#define LOG_ENTRY_SIZE 256          // Bytes por mensagem (o resto é cortado)
+#define LOG_FLUSH_INTERVAL_MS 20    // Espera do escritor com os buffers vazios
+#define LOG_ECHO_CONSOLE 1          // Repetir as mensagens (sem prefixo) no terminal
+#define ASSET_PACK_PATH "assets.pak"    // Gerado por make assets-pack
 
 // === CONFIGURAÇÕES DE REDE ===
 #define NETWORK_PORT 8080
-#define NETWORK_TIMEOUT 5000        // 5 segundos
-#define NETWORK_MAX_CONNECTIONS 4
+#define NETWORK_TIMEOUT 5000        // 5 segundos sem mensagens fecham a conexão
+#define NETWORK_MAX_CONNECTIONS 4   // Padrão do matecheck-server (mude com -c)
+#define NETWORK_CONNECTION_LIMIT 65536
+#define NETWORK_BUFFER_SIZE 512     // Bytes por conexão em cada sentido
+#define NETWORK_TICK_MS 100         // Resolução da roda de timeouts
 
 // === CONFIGURAÇÕES DE SEGURANÇA ===
 #define MAX_INPUT_LENGTH 100
@@ -107,7 +133,9 @@
 #define MIN_MIXER_VERSION 2.0.0
 
 // === CONFIGURAÇÕES DE DESENVOLVIMENTO ===
-#define ENABLE_PROFILING 0
+#ifndef ENABLE_PROFILING
+#define ENABLE_PROFILING 0          // make profile liga o HUD de tempos por quadro
+#endif
 #define ENABLE_MEMORY_DEBUG 0
 #define ENABLE_ASSERTIONS 1
 
@@ -1,8 +1,19 @@
 #include "chess_engine.h"
+#include <limits.h>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSSE3__)
+#include <tmmintrin.h>
+#endif
 
 // Arquivo de demonstração para mostrar as funcionalidades do MateCheck
 // Este arquivo pode ser usado para testar o projeto sem interface gráfica
 
+int fatorial(int n);
+int fibonacci(int n);
+int findKnightMinMoves(Position current, Position target, bool visited[][BOARD_SIZE], int depth);
+
 void demoNovato() {
     printf("=== DEMONSTRAÇÃO MÓDULO NOVATO ===\n");
     printf("Conceitos: for, while, do-while\n\n");
@@ -152,7 +163,449 @@ int findKnightMinMoves(Position current, Position target, bool visited[][BOARD_S
     return minMoves;
 }
 
-int main() {
+// === MODO BATCH: CONSULTAS DE DISTÂNCIA DO CAVALO ===
+// Lê pares (origem, destino) de um arquivo ou da entrada padrão e responde
+// com o número mínimo de lances do cavalo. Casas são índices 0..63 (y * 8 + x)
+// ou notação algébrica ("e4"). No formato binário cada consulta ocupa 2 bytes
+// e cada resposta 1 byte (255 = casa inválida).
+
+#define BATCH_IO_BUFFER (1 << 20)
+#define BATCH_QUERIES 65536
+
+// Distância por (|dx| * 8 + |dy|); a única exceção no 8x8 é a diagonal
+// vizinha de um canto, que custa 4 lances em vez de 2
+static unsigned char knightDeltaTable[64];
+
+static void initKnightDeltaTable(void) {
+    int knightMoves[8][2] = {
+        {2, 1}, {2, -1}, {-2, 1}, {-2, -1},
+        {1, 2}, {1, -2}, {-1, 2}, {-1, -2}
+    };
+    int distance[BOARD_SIZE][BOARD_SIZE];
+    int queue[BOARD_SIZE * BOARD_SIZE][2];
+    int head = 0, tail = 0;
+    
+    // BFS a partir do canto (0, 0): alcança todos os deltas possíveis
+    for (int x = 0; x < BOARD_SIZE; x++) {
+        for (int y = 0; y < BOARD_SIZE; y++) {
+            distance[x][y] = -1;
+        }
+    }
+    distance[0][0] = 0;
+    queue[tail][0] = 0;
+    queue[tail++][1] = 0;
+    
+    while (head < tail) {
+        int x = queue[head][0];
+        int y = queue[head++][1];
+        for (int i = 0; i < 8; i++) {
+            int nx = x + knightMoves[i][0];
+            int ny = y + knightMoves[i][1];
+            if (nx >= 0 && nx < BOARD_SIZE && ny >= 0 && ny < BOARD_SIZE && distance[nx][ny] < 0) {
+                distance[nx][ny] = distance[x][y] + 1;
+                queue[tail][0] = nx;
+                queue[tail++][1] = ny;
+            }
+        }
+    }
+    
+    for (int dx = 0; dx < BOARD_SIZE; dx++) {
+        for (int dy = 0; dy < BOARD_SIZE; dy++) {
+            knightDeltaTable[dx * 8 + dy] = (unsigned char)distance[dx][dy];
+        }
+    }
+    
+    // Fora dos cantos a diagonal vizinha custa 2; o canto é corrigido na consulta
+    knightDeltaTable[1 * 8 + 1] = 2;
+}
+
+static bool isCornerSquare(unsigned char square) {
+    int x = square & 7;
+    int y = square >> 3;
+    return (x == 0 || x == 7) && (y == 0 || y == 7);
+}
+
+// Versão escalar (também usada para o resto que não completa um vetor)
+static void knightDistanceScalar(const unsigned char* from, const unsigned char* to,
+                                 unsigned char* out, int count) {
+    for (int i = 0; i < count; i++) {
+        if (from[i] > 63 || to[i] > 63) {
+            out[i] = 255;
+            continue;
+        }
+        int dx = abs((from[i] & 7) - (to[i] & 7));
+        int dy = abs((from[i] >> 3) - (to[i] >> 3));
+        out[i] = knightDeltaTable[dx * 8 + dy];
+        if (dx == 1 && dy == 1 && (isCornerSquare(from[i]) || isCornerSquare(to[i]))) {
+            out[i] = 4;
+        }
+    }
+}
+
+#if defined(__AVX2__)
+#define KNIGHT_LANES 32
+typedef __m256i KnightVector;
+#define KV_LOAD(p) _mm256_loadu_si256((const __m256i*)(p))
+#define KV_STORE(p, v) _mm256_storeu_si256((__m256i*)(p), v)
+#define KV_SET1(v) _mm256_set1_epi8((char)(v))
+#define KV_AND _mm256_and_si256
+#define KV_OR _mm256_or_si256
+#define KV_ANDNOT _mm256_andnot_si256
+#define KV_EQ _mm256_cmpeq_epi8
+#define KV_MIN _mm256_min_epu8
+#define KV_MAX _mm256_max_epu8
+#define KV_SUB _mm256_sub_epi8
+#define KV_ADD _mm256_add_epi8
+#define KV_SRL16(v, n) _mm256_srli_epi16(v, n)
+#define KV_SHUFFLE _mm256_shuffle_epi8
+// A tabela de 16 bytes é repetida nas duas metades (pshufb atua por faixa de 128 bits)
+#define KV_TABLE(p) _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)(p)))
+#elif defined(__SSSE3__)
+#define KNIGHT_LANES 16
+typedef __m128i KnightVector;
+#define KV_LOAD(p) _mm_loadu_si128((const __m128i*)(p))
+#define KV_STORE(p, v) _mm_storeu_si128((__m128i*)(p), v)
+#define KV_SET1(v) _mm_set1_epi8((char)(v))
+#define KV_AND _mm_and_si128
+#define KV_OR _mm_or_si128
+#define KV_ANDNOT _mm_andnot_si128
+#define KV_EQ _mm_cmpeq_epi8
+#define KV_MIN _mm_min_epu8
+#define KV_MAX _mm_max_epu8
+#define KV_SUB _mm_sub_epi8
+#define KV_ADD _mm_add_epi8
+#define KV_SRL16(v, n) _mm_srli_epi16(v, n)
+#define KV_SHUFFLE _mm_shuffle_epi8
+#define KV_TABLE(p) _mm_loadu_si128((const __m128i*)(p))
+#endif
+
+// Responde KNIGHT_LANES consultas por iteração: a tabela de 64 bytes é
+// consultada com quatro pshufb (16 entradas cada), sem acessos escalares
+static void knightDistanceBatch(const unsigned char* from, const unsigned char* to,
+                                unsigned char* out, int count) {
+    int i = 0;
+#ifdef KNIGHT_LANES
+    const KnightVector seven = KV_SET1(7);
+    const KnightVector fifteen = KV_SET1(15);
+    const KnightVector limit = KV_SET1(63);
+    const KnightVector one = KV_SET1(1);
+    const KnightVector zero = KV_SET1(0);
+    const KnightVector four = KV_SET1(4);
+    const KnightVector invalid = KV_SET1(255);
+    KnightVector table[4];
+    for (int k = 0; k < 4; k++) {
+        table[k] = KV_TABLE(knightDeltaTable + 16 * k);
+    }
+    
+    for (; i + KNIGHT_LANES <= count; i += KNIGHT_LANES) {
+        KnightVector f = KV_LOAD(from + i);
+        KnightVector t = KV_LOAD(to + i);
+        
+        // Casas fora de 0..63 viram 255 no final
+        KnightVector largest = KV_MAX(f, t);
+        KnightVector bad = KV_ANDNOT(KV_EQ(KV_MIN(largest, limit), largest), invalid);
+        
+        KnightVector fx = KV_AND(f, seven);
+        KnightVector tx = KV_AND(t, seven);
+        KnightVector fy = KV_AND(KV_SRL16(f, 3), seven);
+        KnightVector ty = KV_AND(KV_SRL16(t, 3), seven);
+        KnightVector dx = KV_SUB(KV_MAX(fx, tx), KV_MIN(fx, tx));
+        KnightVector dy = KV_SUB(KV_MAX(fy, ty), KV_MIN(fy, ty));
+        
+        // Índice dx * 8 + dy, dividido em bloco (0..3) e deslocamento (0..15)
+        KnightVector dx2 = KV_ADD(dx, dx);
+        KnightVector dx4 = KV_ADD(dx2, dx2);
+        KnightVector index = KV_ADD(KV_ADD(dx4, dx4), dy);
+        KnightVector low = KV_AND(index, fifteen);
+        KnightVector block = KV_AND(KV_SRL16(index, 4), KV_SET1(3));
+        
+        KnightVector result = zero;
+        for (int k = 0; k < 4; k++) {
+            KnightVector inBlock = KV_EQ(block, KV_SET1(k));
+            result = KV_OR(result, KV_AND(inBlock, KV_SHUFFLE(table[k], low)));
+        }
+        
+        // Diagonal vizinha de um canto: 4 lances
+        KnightVector edgeFx = KV_OR(KV_EQ(fx, zero), KV_EQ(fx, seven));
+        KnightVector edgeFy = KV_OR(KV_EQ(fy, zero), KV_EQ(fy, seven));
+        KnightVector edgeTx = KV_OR(KV_EQ(tx, zero), KV_EQ(tx, seven));
+        KnightVector edgeTy = KV_OR(KV_EQ(ty, zero), KV_EQ(ty, seven));
+        KnightVector corner = KV_OR(KV_AND(edgeFx, edgeFy), KV_AND(edgeTx, edgeTy));
+        KnightVector nearDiagonal = KV_AND(KV_EQ(dx, one), KV_EQ(dy, one));
+        KnightVector fix = KV_AND(corner, nearDiagonal);
+        result = KV_OR(KV_ANDNOT(fix, result), KV_AND(fix, four));
+        
+        result = KV_OR(result, bad);
+        KV_STORE(out + i, result);
+    }
+#endif
+    knightDistanceScalar(from + i, to + i, out + i, count - i);
+}
+
+static unsigned char queryFrom[BATCH_QUERIES];
+static unsigned char queryTo[BATCH_QUERIES];
+static unsigned char queryAnswer[BATCH_QUERIES];
+static char inputBuffer[BATCH_IO_BUFFER];
+static char outputBuffer[BATCH_IO_BUFFER];
+
+typedef struct {
+    FILE* out;
+    bool binary;
+    int outputUsed;
+    long long queries;
+    Uint64 lookupTicks;
+} KnightBatch;
+
+static void flushBatchOutput(KnightBatch* batch) {
+    if (batch->outputUsed > 0) {
+        fwrite(outputBuffer, 1, batch->outputUsed, batch->out);
+        batch->outputUsed = 0;
+    }
+}
+
+// Responde as consultas acumuladas e grava as respostas no buffer de saída
+static void answerQueries(KnightBatch* batch, int count) {
+    Uint64 start = SDL_GetPerformanceCounter();
+    knightDistanceBatch(queryFrom, queryTo, queryAnswer, count);
+    batch->lookupTicks += SDL_GetPerformanceCounter() - start;
+    batch->queries += count;
+    
+    if (batch->binary) {
+        if (batch->outputUsed + count > BATCH_IO_BUFFER) {
+            flushBatchOutput(batch);
+        }
+        memcpy(outputBuffer + batch->outputUsed, queryAnswer, count);
+        batch->outputUsed += count;
+        return;
+    }
+    
+    for (int i = 0; i < count; i++) {
+        if (batch->outputUsed + 2 > BATCH_IO_BUFFER) {
+            flushBatchOutput(batch);
+        }
+        unsigned char answer = queryAnswer[i];
+        outputBuffer[batch->outputUsed++] = answer == 255 ? '-' : (char)('0' + answer);
+        outputBuffer[batch->outputUsed++] = '\n';
+    }
+}
+
+// Converte "e4" ou "28" em índice 0..63 (255 se inválido)
+static unsigned char parseSquareToken(const char** cursor, const char* end) {
+    const char* p = *cursor;
+    while (p < end && (*p == ' ' || *p == '\t' || *p == ',' || *p == '\r')) p++;
+    
+    unsigned char square = 255;
+    if (p + 1 < end && p[0] >= 'a' && p[0] <= 'h' && p[1] >= '1' && p[1] <= '8') {
+        int x = p[0] - 'a';
+        int y = BOARD_SIZE - (p[1] - '0');   // Linha 8 fica no topo (y = 0)
+        square = (unsigned char)(y * 8 + x);
+        p += 2;
+    } else if (p < end && p[0] >= '0' && p[0] <= '9') {
+        int value = 0;
+        while (p < end && *p >= '0' && *p <= '9') {
+            value = value * 10 + (*p - '0');
+            if (value > 255) value = 255;
+            p++;
+        }
+        square = (unsigned char)(value > 63 ? 255 : value);
+    }
+    
+    // Qualquer sobra no token invalida a casa
+    while (p < end && *p != ' ' && *p != '\t' && *p != ',' && *p != '\r' && *p != '\n') {
+        p++;
+        square = 255;
+    }
+    *cursor = p;
+    return square;
+}
+
+static void runTextBatch(KnightBatch* batch, FILE* in) {
+    int carried = 0;
+    int pending = 0;
+    
+    for (;;) {
+        size_t bytesRead = fread(inputBuffer + carried, 1, BATCH_IO_BUFFER - carried, in);
+        int available = carried + (int)bytesRead;
+        bool finished = bytesRead == 0;
+        if (available == 0) break;
+        
+        // Processar apenas linhas completas; o resto segue para a próxima leitura
+        int usable = available;
+        if (!finished) {
+            while (usable > 0 && inputBuffer[usable - 1] != '\n') usable--;
+            if (usable == 0) {
+                usable = available;  // Linha maior que o buffer: processar assim mesmo
+            }
+        }
+        
+        const char* p = inputBuffer;
+        const char* end = inputBuffer + usable;
+        while (p < end) {
+            const char* lineEnd = memchr(p, '\n', end - p);
+            if (!lineEnd) lineEnd = end;
+            
+            const char* q = p;
+            while (q < lineEnd && (*q == ' ' || *q == '\t' || *q == '\r')) q++;
+            if (q < lineEnd && *q != '#') {
+                queryFrom[pending] = parseSquareToken(&q, lineEnd);
+                queryTo[pending] = parseSquareToken(&q, lineEnd);
+                if (++pending == BATCH_QUERIES) {
+                    answerQueries(batch, pending);
+                    pending = 0;
+                }
+            }
+            p = lineEnd + 1;
+        }
+        
+        carried = available - usable;
+        memmove(inputBuffer, inputBuffer + usable, carried);
+        if (finished) break;
+    }
+    
+    if (pending > 0) {
+        answerQueries(batch, pending);
+    }
+}
+
+static void runBinaryBatch(KnightBatch* batch, FILE* in) {
+    int carried = 0;
+    
+    for (;;) {
+        size_t bytesRead = fread(inputBuffer + carried, 1, BATCH_QUERIES * 2 - carried, in);
+        int available = carried + (int)bytesRead;
+        int count = available / 2;
+        
+        for (int i = 0; i < count; i++) {
+            queryFrom[i] = (unsigned char)inputBuffer[2 * i];
+            queryTo[i] = (unsigned char)inputBuffer[2 * i + 1];
+        }
+        if (count > 0) {
+            answerQueries(batch, count);
+        }
+        
+        // Um byte ímpar no fim da leitura segue para a próxima
+        carried = available - count * 2;
+        if (carried > 0) {
+            inputBuffer[0] = inputBuffer[available - 1];
+        }
+        if (bytesRead == 0) break;
+    }
+}
+
+// Modo batch: consultas de distância do cavalo em grande volume
+int runKnightBatch(const char* inputPath, const char* outputPath, bool binary) {
+    FILE* in = inputPath ? fopen(inputPath, binary ? "rb" : "r") : stdin;
+    if (!in) {
+        fprintf(stderr, "Erro ao abrir %s\n", inputPath);
+        return 1;
+    }
+    FILE* out = outputPath ? fopen(outputPath, binary ? "wb" : "w") : stdout;
+    if (!out) {
+        fprintf(stderr, "Erro ao criar %s\n", outputPath);
+        if (in != stdin) fclose(in);
+        return 1;
+    }
+    
+    initKnightDeltaTable();
+    
+    KnightBatch batch = {0};
+    batch.out = out;
+    batch.binary = binary;
+    
+    Uint64 start = SDL_GetPerformanceCounter();
+    if (binary) {
+        runBinaryBatch(&batch, in);
+    } else {
+        runTextBatch(&batch, in);
+    }
+    flushBatchOutput(&batch);
+    fflush(out);
+    double elapsed = (double)(SDL_GetPerformanceCounter() - start) / SDL_GetPerformanceFrequency();
+    double lookup = (double)batch.lookupTicks / SDL_GetPerformanceFrequency();
+    
+    if (in != stdin) fclose(in);
+    if (out != stdout) fclose(out);
+    
+#ifdef KNIGHT_LANES
+    int lanes = KNIGHT_LANES;
+#else
+    int lanes = 1;
+#endif
+    fprintf(stderr, "Consultas: %lld (%d por vetor)\n", batch.queries, lanes);
+    fprintf(stderr, "Tempo total: %.3f s (%.0f consultas/s)\n",
+            elapsed, elapsed > 0 ? batch.queries / elapsed : 0.0);
+    fprintf(stderr, "Tempo de consulta: %.3f s (%.0f consultas/s)\n",
+            lookup, lookup > 0 ? batch.queries / lookup : 0.0);
+    return 0;
+}
+
+// Gera consultas aleatórias no formato binário para o benchmark
+int generateKnightQueries(long long count, const char* outputPath) {
+    FILE* out = outputPath ? fopen(outputPath, "wb") : stdout;
+    if (!out) {
+        fprintf(stderr, "Erro ao criar %s\n", outputPath);
+        return 1;
+    }
+    
+    unsigned int state = 12345;
+    int used = 0;
+    for (long long i = 0; i < count; i++) {
+        if (used + 2 > BATCH_IO_BUFFER) {
+            fwrite(outputBuffer, 1, used, out);
+            used = 0;
+        }
+        state = state * 1103515245u + 12345u;
+        outputBuffer[used++] = (char)((state >> 16) & 63);
+        outputBuffer[used++] = (char)((state >> 24) & 63);
+    }
+    fwrite(outputBuffer, 1, used, out);
+    
+    if (out != stdout) fclose(out);
+    return 0;
+}
+
+static void printDemoUsage(void) {
+    printf("Uso:\n");
+    printf("  matecheck-demo                         Demonstrações dos módulos\n");
+    printf("  matecheck-demo --batch [opções]        Distâncias do cavalo em lote\n");
+    printf("      --binary          Entrada com 2 bytes por consulta, saída com 1 byte\n");
+    printf("      --input ARQUIVO   Ler consultas do arquivo (padrão: entrada padrão)\n");
+    printf("      --output ARQUIVO  Gravar respostas no arquivo (padrão: saída padrão)\n");
+    printf("  matecheck-demo --generate N [--output ARQUIVO]\n");
+    printf("                                         Gerar N consultas binárias aleatórias\n");
+}
+
+int main(int argc, char* argv[]) {
+    const char* inputPath = NULL;
+    const char* outputPath = NULL;
+    bool batchMode = false;
+    bool binary = false;
+    long long generateCount = -1;
+    
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--batch") == 0) {
+            batchMode = true;
+        } else if (strcmp(argv[i], "--binary") == 0) {
+            binary = true;
+        } else if (strcmp(argv[i], "--input") == 0 && i + 1 < argc) {
+            inputPath = argv[++i];
+        } else if (strcmp(argv[i], "--output") == 0 && i + 1 < argc) {
+            outputPath = argv[++i];
+        } else if (strcmp(argv[i], "--generate") == 0 && i + 1 < argc) {
+            generateCount = atoll(argv[++i]);
+        } else {
+            printDemoUsage();
+            return strcmp(argv[i], "--help") == 0 ? 0 : 1;
+        }
+    }
+    
+    if (generateCount >= 0) {
+        return generateKnightQueries(generateCount, outputPath);
+    }
+    if (batchMode) {
+        return runKnightBatch(inputPath, outputPath, binary);
+    }
+    
     printf("========================================\n");
     printf("    MATE CHECK - DEMONSTRAÇÃO\n");
     printf("    Desenvolvido por Daniel Barbieri Dev\n");
@@ -0,0 +1,279 @@
+#include "chess_engine.h"
+
+// Busca por números de prova em profundidade (df-pn) para provar mates
+// Nós OU: o atacante escolhe um lance (basta um filho provado).
+// Nós E: o defensor responde (todos os filhos precisam ser provados).
+// pn = quanto falta para provar o mate, dn = quanto falta para refutá-lo.
+// A tabela tem tamanho fixo; quando enche, a coleta de lixo remove as
+// entradas com menos trabalho acumulado (subárvores pequenas, baratas de refazer).
+// Limites de nós e de tempo interrompem a busca sem resposta (nem provado nem
+// refutado); o relógio é consultado a cada DFPN_CLOCK_INTERVAL nós.
+
+#define DFPN_INFINITY 100000000u
+#define DFPN_BUCKET 4
+#define DFPN_GC_THRESHOLD 0.85
+#define DFPN_GC_TARGET 0.5
+#define DFPN_CLOCK_INTERVAL 1024
+
+typedef struct {
+    Uint64 key;         // 0 = vazia
+    Uint32 pn;
+    Uint32 dn;
+    Uint32 work;        // Nós gastos na subárvore (prioridade na coleta de lixo)
+} DfpnEntry;
+
+typedef struct {
+    DfpnEntry* entries;
+    long capacity;      // Múltiplo de DFPN_BUCKET
+    long used;
+    long peak;
+    int gcRuns;
+    long long nodes;
+    long long maxNodes;
+    Uint32 startTicks;
+    Uint32 timeLimitMs;         // 0 = sem limite de tempo
+    bool aborted;
+    Uint64 rootKey;
+    Uint32 rootPn, rootDn;      // Resultado da raiz, fora da tabela (a coleta pode removê-la)
+    Move rootMove;              // Filho provado da raiz
+} DfpnTable;
+
+static Uint32 addSaturated(Uint32 a, Uint32 b) {
+    Uint32 sum = a + b;
+    return (sum < a || sum > DFPN_INFINITY) ? DFPN_INFINITY : sum;
+}
+
+// A profundidade restante entra na chave: a mesma posição com menos lances
+// disponíveis é um problema diferente
+static Uint64 dfpnKey(ChessBoard* board, int movesLeft) {
+    Uint64 key = computeBoardHash(board) ^ ((Uint64)(movesLeft + 1) * 0xD6E8FEB86659FD93ULL);
+    return key ? key : 1;
+}
+
+static DfpnEntry* lookupEntry(DfpnTable* table, Uint64 key) {
+    long bucket = (long)(key % (Uint64)(table->capacity / DFPN_BUCKET)) * DFPN_BUCKET;
+    for (int i = 0; i < DFPN_BUCKET; i++) {
+        if (table->entries[bucket + i].key == key) {
+            return &table->entries[bucket + i];
+        }
+    }
+    return NULL;
+}
+
+// Coleta de lixo: descarta entradas não resolvidas com pouco trabalho,
+// dobrando o limite até liberar o suficiente
+static void collectGarbage(DfpnTable* table) {
+    Uint32 limit = 1;
+    long goal = (long)(table->capacity * DFPN_GC_TARGET);
+
+    while (table->used > goal && limit < DFPN_INFINITY) {
+        for (long i = 0; i < table->capacity; i++) {
+            DfpnEntry* entry = &table->entries[i];
+            if (entry->key == 0 || entry->work >= limit) continue;
+
+            bool solved = entry->pn == 0 || entry->dn == 0;
+            if (!solved || limit > 64) {
+                entry->key = 0;
+                table->used--;
+            }
+        }
+        limit *= 2;
+    }
+    table->gcRuns++;
+}
+
+static void storeEntry(DfpnTable* table, Uint64 key, Uint32 pn, Uint32 dn, Uint32 work) {
+    DfpnEntry* entry = lookupEntry(table, key);
+
+    if (!entry) {
+        if (table->used >= (long)(table->capacity * DFPN_GC_THRESHOLD)) {
+            collectGarbage(table);
+        }
+
+        // Vaga livre no balde ou, se cheio, a entrada com menos trabalho
+        long bucket = (long)(key % (Uint64)(table->capacity / DFPN_BUCKET)) * DFPN_BUCKET;
+        entry = &table->entries[bucket];
+        for (int i = 0; i < DFPN_BUCKET; i++) {
+            DfpnEntry* candidate = &table->entries[bucket + i];
+            if (candidate->key == 0) {
+                entry = candidate;
+                break;
+            }
+            if (candidate->work < entry->work) {
+                entry = candidate;
+            }
+        }
+        if (entry->key == 0) {
+            table->used++;
+            if (table->used > table->peak) {
+                table->peak = table->used;
+            }
+        }
+        entry->key = key;
+        entry->work = 0;
+    }
+
+    entry->pn = pn;
+    entry->dn = dn;
+    entry->work = addSaturated(entry->work, work);
+}
+
+static void readEntry(DfpnTable* table, Uint64 key, Uint32* pn, Uint32* dn) {
+    DfpnEntry* entry = lookupEntry(table, key);
+    if (entry) {
+        *pn = entry->pn;
+        *dn = entry->dn;
+    } else {
+        *pn = 1;
+        *dn = 1;
+    }
+}
+
+static void storeResult(DfpnTable* table, Uint64 key, Uint32 pn, Uint32 dn, Uint32 work) {
+    storeEntry(table, key, pn, dn, work);
+    if (key == table->rootKey) {
+        table->rootPn = pn;
+        table->rootDn = dn;
+    }
+}
+
+// Expande um nó até que pn >= limite de prova ou dn >= limite de refutação
+static void dfpnSearch(DfpnTable* table, ChessBoard* board, bool orNode, int movesLeft,
+                       Uint32 proofLimit, Uint32 disproofLimit) {
+    Uint64 key = dfpnKey(board, movesLeft);
+    long long nodesBefore = table->nodes;
+    table->nodes++;
+    if (table->timeLimitMs > 0 && table->nodes % DFPN_CLOCK_INTERVAL == 0 &&
+        SDL_GetTicks() - table->startTicks >= table->timeLimitMs) {
+        table->aborted = true;
+    }
+
+    Move moves[MAX_LEGAL_MOVES];
+    int count = generateLegalMoves(board, moves);
+
+    // Nós terminais
+    if (count == 0) {
+        bool mated = !orNode && isKingInCheck(board, board->currentPlayer);
+        storeResult(table, key, mated ? 0 : DFPN_INFINITY, mated ? DFPN_INFINITY : 0, 1);
+        return;
+    }
+    if (movesLeft == 0) {   // Lances do atacante esgotados sem mate
+        storeResult(table, key, DFPN_INFINITY, 0, 1);
+        return;
+    }
+
+    int childMoves = orNode ? movesLeft - 1 : movesLeft;
+    Uint64 childKeys[MAX_LEGAL_MOVES];
+    for (int i = 0; i < count; i++) {
+        MoveUndo undo;
+        applyMove(board, moves[i], &undo);
+        childKeys[i] = dfpnKey(board, childMoves);
+        undoMove(board, &undo);
+    }
+
+    Uint32 pn = 0, dn = 0;
+    int bestIndex = 0;
+    for (;;) {
+        // Recalcular pn/dn a partir dos filhos e escolher o mais promissor
+        Uint32 best = DFPN_INFINITY, second = DFPN_INFINITY, bestOther = 0;
+        Uint32 sum = 0;
+        bestIndex = 0;
+
+        for (int i = 0; i < count; i++) {
+            Uint32 childPn, childDn;
+            readEntry(table, childKeys[i], &childPn, &childDn);
+
+            // Em nó OU minimiza-se pn dos filhos; em nó E, dn
+            Uint32 selector = orNode ? childPn : childDn;
+            Uint32 other = orNode ? childDn : childPn;
+            sum = addSaturated(sum, other);
+            if (selector < best) {
+                second = best;
+                best = selector;
+                bestOther = other;
+                bestIndex = i;
+            } else if (selector < second) {
+                second = selector;
+            }
+        }
+
+        pn = orNode ? best : sum;
+        dn = orNode ? sum : best;
+
+        if (pn >= proofLimit || dn >= disproofLimit || table->aborted) {
+            break;
+        }
+        if (table->maxNodes > 0 && table->nodes >= table->maxNodes) {
+            table->aborted = true;
+            break;
+        }
+
+        // Limites do filho (Nagai): irmão seguinte + 1 e a folga do pai
+        Uint32 ownLimit = orNode ? proofLimit : disproofLimit;
+        Uint32 sumLimit = orNode ? disproofLimit : proofLimit;
+        Uint32 childSelectorLimit = second == DFPN_INFINITY ? ownLimit
+                                  : (ownLimit < second + 1 ? ownLimit : second + 1);
+        Uint32 childOtherLimit = sumLimit >= DFPN_INFINITY ? DFPN_INFINITY
+                               : addSaturated(sumLimit - sum, bestOther);
+
+        MoveUndo undo;
+        applyMove(board, moves[bestIndex], &undo);
+        if (orNode) {
+            dfpnSearch(table, board, false, childMoves, childSelectorLimit, childOtherLimit);
+        } else {
+            dfpnSearch(table, board, true, childMoves, childOtherLimit, childSelectorLimit);
+        }
+        undoMove(board, &undo);
+    }
+
+    storeResult(table, key, pn, dn, (Uint32)(table->nodes - nodesBefore));
+    if (key == table->rootKey && pn == 0) {
+        table->rootMove = moves[bestIndex];     // Na raiz (nó OU) provada, o melhor filho tem pn 0
+    }
+}
+
+// Resolve a posição para mate do lado da vez em até maxMoves lances.
+// tableMegabytes limita a memória da tabela; maxNodes e maxMilliseconds = 0
+// significam sem limite.
+bool solveMateDfpn(ChessBoard* board, int maxMoves, int tableMegabytes,
+                   long long maxNodes, Uint32 maxMilliseconds, DfpnResult* result) {
+    DfpnTable table = {0};
+    memset(result, 0, sizeof(DfpnResult));
+
+    if (tableMegabytes <= 0) {
+        tableMegabytes = DFPN_DEFAULT_TABLE_MB;
+    }
+    table.capacity = ((long)tableMegabytes * 1024 * 1024 / (long)sizeof(DfpnEntry)) / DFPN_BUCKET * DFPN_BUCKET;
+    table.entries = (DfpnEntry*)calloc((size_t)table.capacity, sizeof(DfpnEntry));
+    if (!table.entries) {
+        return false;
+    }
+    table.maxNodes = maxNodes;
+    table.timeLimitMs = maxMilliseconds;
+    table.startTicks = SDL_GetTicks();
+    table.rootKey = dfpnKey(board, maxMoves);
+    table.rootPn = 1;
+    table.rootDn = 1;
+
+    Uint64 start = SDL_GetPerformanceCounter();
+    dfpnSearch(&table, board, true, maxMoves, DFPN_INFINITY, DFPN_INFINITY);
+    Uint64 ticks = SDL_GetPerformanceCounter() - start;
+
+    result->proven = table.rootPn == 0;
+    result->disproven = table.rootDn == 0;
+    if (result->proven) {
+        result->bestMove = table.rootMove;
+    }
+
+    result->nodes = table.nodes;
+    result->seconds = (double)ticks / (double)SDL_GetPerformanceFrequency();
+    result->nodesPerSecond = result->seconds > 0 ? table.nodes / result->seconds : 0.0;
+    result->tableCapacity = table.capacity;
+    result->peakEntries = table.peak;
+    result->peakBytes = table.peak * (long)sizeof(DfpnEntry);
+    result->gcRuns = table.gcRuns;
+    result->aborted = table.aborted;
+
+    free(table.entries);
+    return result->proven;
+}
@@ -0,0 +1,166 @@
+#include "chess_engine.h"
+
+// Fonte embutida 5x7 para quando nenhuma fonte TTF está carregada
+// (primeiros quadros enquanto o carregador roda, ou sem assets/fonts).
+// Os 95 caracteres ASCII imprimíveis viram uma textura única na primeira
+// vez; cada texto é uma única chamada de SDL_RenderGeometry, com a cor
+// nos vértices. Letras acentuadas em UTF-8 são desenhadas sem o acento.
+
+#define GLYPH_WIDTH 5
+#define GLYPH_HEIGHT 7
+#define GLYPH_FIRST 32
+#define GLYPH_COUNT 95
+#define GLYPH_CELL 6                // Largura da célula na textura (5 + 1 de folga)
+#define FALLBACK_BATCH 128          // Caracteres por chamada de desenho
+
+// Uma coluna por byte, bit 0 = linha de cima
+static const Uint8 glyphs[GLYPH_COUNT][GLYPH_WIDTH] = {
+    {0x00, 0x00, 0x00, 0x00, 0x00}, {0x00, 0x00, 0x5F, 0x00, 0x00}, {0x00, 0x07, 0x00, 0x07, 0x00},
+    {0x14, 0x7F, 0x14, 0x7F, 0x14}, {0x24, 0x2A, 0x7F, 0x2A, 0x12}, {0x23, 0x13, 0x08, 0x64, 0x62},
+    {0x36, 0x49, 0x55, 0x22, 0x50}, {0x00, 0x05, 0x03, 0x00, 0x00}, {0x00, 0x1C, 0x22, 0x41, 0x00},
+    {0x00, 0x41, 0x22, 0x1C, 0x00}, {0x08, 0x2A, 0x1C, 0x2A, 0x08}, {0x08, 0x08, 0x3E, 0x08, 0x08},
+    {0x00, 0x50, 0x30, 0x00, 0x00}, {0x08, 0x08, 0x08, 0x08, 0x08}, {0x00, 0x60, 0x60, 0x00, 0x00},
+    {0x20, 0x10, 0x08, 0x04, 0x02}, {0x3E, 0x51, 0x49, 0x45, 0x3E}, {0x00, 0x42, 0x7F, 0x40, 0x00},
+    {0x42, 0x61, 0x51, 0x49, 0x46}, {0x21, 0x41, 0x45, 0x4B, 0x31}, {0x18, 0x14, 0x12, 0x7F, 0x10},
+    {0x27, 0x45, 0x45, 0x45, 0x39}, {0x3C, 0x4A, 0x49, 0x49, 0x30}, {0x01, 0x71, 0x09, 0x05, 0x03},
+    {0x36, 0x49, 0x49, 0x49, 0x36}, {0x06, 0x49, 0x49, 0x29, 0x1E}, {0x00, 0x36, 0x36, 0x00, 0x00},
+    {0x00, 0x56, 0x36, 0x00, 0x00}, {0x08, 0x14, 0x22, 0x41, 0x00}, {0x14, 0x14, 0x14, 0x14, 0x14},
+    {0x00, 0x41, 0x22, 0x14, 0x08}, {0x02, 0x01, 0x51, 0x09, 0x06}, {0x32, 0x49, 0x79, 0x41, 0x3E},
+    {0x7E, 0x11, 0x11, 0x11, 0x7E}, {0x7F, 0x49, 0x49, 0x49, 0x36}, {0x3E, 0x41, 0x41, 0x41, 0x22},
+    {0x7F, 0x41, 0x41, 0x22, 0x1C}, {0x7F, 0x49, 0x49, 0x49, 0x41}, {0x7F, 0x09, 0x09, 0x01, 0x01},
+    {0x3E, 0x41, 0x41, 0x51, 0x32}, {0x7F, 0x08, 0x08, 0x08, 0x7F}, {0x00, 0x41, 0x7F, 0x41, 0x00},
+    {0x20, 0x40, 0x41, 0x3F, 0x01}, {0x7F, 0x08, 0x14, 0x22, 0x41}, {0x7F, 0x40, 0x40, 0x40, 0x40},
+    {0x7F, 0x02, 0x04, 0x02, 0x7F}, {0x7F, 0x04, 0x08, 0x10, 0x7F}, {0x3E, 0x41, 0x41, 0x41, 0x3E},
+    {0x7F, 0x09, 0x09, 0x09, 0x06}, {0x3E, 0x41, 0x51, 0x21, 0x5E}, {0x7F, 0x09, 0x19, 0x29, 0x46},
+    {0x46, 0x49, 0x49, 0x49, 0x31}, {0x01, 0x01, 0x7F, 0x01, 0x01}, {0x3F, 0x40, 0x40, 0x40, 0x3F},
+    {0x1F, 0x20, 0x40, 0x20, 0x1F}, {0x7F, 0x20, 0x18, 0x20, 0x7F}, {0x63, 0x14, 0x08, 0x14, 0x63},
+    {0x03, 0x04, 0x78, 0x04, 0x03}, {0x61, 0x51, 0x49, 0x45, 0x43}, {0x00, 0x7F, 0x41, 0x41, 0x00},
+    {0x02, 0x04, 0x08, 0x10, 0x20}, {0x00, 0x41, 0x41, 0x7F, 0x00}, {0x04, 0x02, 0x01, 0x02, 0x04},
+    {0x40, 0x40, 0x40, 0x40, 0x40}, {0x00, 0x01, 0x02, 0x04, 0x00}, {0x20, 0x54, 0x54, 0x54, 0x78},
+    {0x7F, 0x48, 0x44, 0x44, 0x38}, {0x38, 0x44, 0x44, 0x44, 0x20}, {0x38, 0x44, 0x44, 0x48, 0x7F},
+    {0x38, 0x54, 0x54, 0x54, 0x18}, {0x08, 0x7E, 0x09, 0x01, 0x02}, {0x08, 0x54, 0x54, 0x54, 0x3C},
+    {0x7F, 0x08, 0x04, 0x04, 0x78}, {0x00, 0x44, 0x7D, 0x40, 0x00}, {0x20, 0x40, 0x44, 0x3D, 0x00},
+    {0x7F, 0x10, 0x28, 0x44, 0x00}, {0x00, 0x41, 0x7F, 0x40, 0x00}, {0x7C, 0x04, 0x18, 0x04, 0x78},
+    {0x7C, 0x08, 0x04, 0x04, 0x78}, {0x38, 0x44, 0x44, 0x44, 0x38}, {0x7C, 0x14, 0x14, 0x14, 0x08},
+    {0x08, 0x14, 0x14, 0x18, 0x7C}, {0x7C, 0x08, 0x04, 0x04, 0x08}, {0x48, 0x54, 0x54, 0x54, 0x20},
+    {0x04, 0x3F, 0x44, 0x40, 0x20}, {0x3C, 0x40, 0x40, 0x20, 0x7C}, {0x1C, 0x20, 0x40, 0x20, 0x1C},
+    {0x3C, 0x40, 0x30, 0x40, 0x3C}, {0x44, 0x28, 0x10, 0x28, 0x44}, {0x0C, 0x50, 0x50, 0x50, 0x3C},
+    {0x44, 0x64, 0x54, 0x4C, 0x44}, {0x00, 0x08, 0x36, 0x41, 0x00}, {0x00, 0x00, 0x7F, 0x00, 0x00},
+    {0x00, 0x41, 0x36, 0x08, 0x00}, {0x08, 0x04, 0x08, 0x10, 0x08}
+};
+
+static SDL_Texture* glyphTexture = NULL;
+static SDL_Renderer* glyphRenderer = NULL;
+static SDL_Vertex vertices[FALLBACK_BATCH * 4];
+static int indices[FALLBACK_BATCH * 6];
+
+static bool buildGlyphTexture(SDL_Renderer* renderer) {
+    destroyFallbackFont();
+
+    SDL_Surface* surface = SDL_CreateRGBSurfaceWithFormat(0, GLYPH_COUNT * GLYPH_CELL, GLYPH_HEIGHT,
+                                                          32, SDL_PIXELFORMAT_RGBA32);
+    if (!surface) {
+        return false;
+    }
+    memset(surface->pixels, 0, (size_t)surface->pitch * surface->h);
+
+    for (int g = 0; g < GLYPH_COUNT; g++) {
+        for (int column = 0; column < GLYPH_WIDTH; column++) {
+            for (int row = 0; row < GLYPH_HEIGHT; row++) {
+                if (!(glyphs[g][column] & (1 << row))) continue;
+                Uint8* pixel = (Uint8*)surface->pixels + (size_t)row * surface->pitch +
+                               (g * GLYPH_CELL + column) * 4;
+                pixel[0] = pixel[1] = pixel[2] = pixel[3] = 255;
+            }
+        }
+    }
+
+    glyphTexture = SDL_CreateTextureFromSurface(renderer, surface);
+    SDL_FreeSurface(surface);
+    if (!glyphTexture) {
+        return false;
+    }
+    SDL_SetTextureBlendMode(glyphTexture, SDL_BLENDMODE_BLEND);
+    glyphRenderer = renderer;
+
+    for (int i = 0; i < FALLBACK_BATCH; i++) {
+        int* quad = &indices[i * 6];
+        quad[0] = i * 4;
+        quad[1] = i * 4 + 1;
+        quad[2] = i * 4 + 2;
+        quad[3] = i * 4 + 2;
+        quad[4] = i * 4 + 3;
+        quad[5] = i * 4;
+    }
+    return true;
+}
+
+void destroyFallbackFont(void) {
+    if (glyphTexture) {
+        SDL_DestroyTexture(glyphTexture);
+        glyphTexture = NULL;
+    }
+    glyphRenderer = NULL;
+}
+
+// Próximo caractere do texto UTF-8 como índice de glifo (acentos são ignorados)
+static int nextGlyph(const unsigned char** text) {
+    unsigned char c = *(*text)++;
+    if (c < 0x80) {
+        return c >= GLYPH_FIRST && c < GLYPH_FIRST + GLYPH_COUNT ? c - GLYPH_FIRST : '?' - GLYPH_FIRST;
+    }
+
+    // Sequência multibyte: pular os bytes de continuação
+    unsigned char next = **text;
+    while ((**text & 0xC0) == 0x80) (*text)++;
+
+    if (c == 0xC3) {
+        static const char latin1[] = "AAAAAAACEEEEIIIIDNOOOOOxOUUUUYTsaaaaaaaceeeeiiiidnooooo/ouuuuyty";
+        if (next >= 0x80 && next <= 0xBF) {
+            return latin1[next - 0x80] - GLYPH_FIRST;
+        }
+    } else if (c == 0xC2 && (next == 0xB2 || next == 0xB3)) {
+        return (next == 0xB2 ? '2' : '3') - GLYPH_FIRST;   // ² e ³
+    } else if (c == 0xC2 && next == 0xB1) {
+        return '+' - GLYPH_FIRST;                           // ±
+    }
+    return '?' - GLYPH_FIRST;
+}
+
+void drawFallbackText(ChessGame* game, const char* text, int x, int y, SDL_Color color) {
+    if (glyphRenderer != game->renderer && !buildGlyphTexture(game->renderer)) {
+        return;
+    }
+
+    // Pixels inteiros por ponto do glifo: nítido em qualquer escala
+    int dot = (game->layout.fontSize + GLYPH_HEIGHT / 2) / (GLYPH_HEIGHT + 1);
+    if (dot < 1) dot = 1;
+
+    const unsigned char* cursor = (const unsigned char*)text;
+    float textureWidth = (float)(GLYPH_COUNT * GLYPH_CELL);
+    int penX = x;
+
+    while (*cursor) {
+        int count = 0;
+        while (*cursor && count < FALLBACK_BATCH) {
+            int glyph = nextGlyph(&cursor);
+            float u0 = glyph * GLYPH_CELL / textureWidth;
+            float u1 = (glyph * GLYPH_CELL + GLYPH_WIDTH) / textureWidth;
+            float left = (float)penX, right = (float)(penX + GLYPH_WIDTH * dot);
+            float top = (float)y, bottom = (float)(y + GLYPH_HEIGHT * dot);
+
+            SDL_Vertex* quad = &vertices[count * 4];
+            quad[0].position.x = left;  quad[0].position.y = top;    quad[0].tex_coord.x = u0; quad[0].tex_coord.y = 0.0f;
+            quad[1].position.x = right; quad[1].position.y = top;    quad[1].tex_coord.x = u1; quad[1].tex_coord.y = 0.0f;
+            quad[2].position.x = right; quad[2].position.y = bottom; quad[2].tex_coord.x = u1; quad[2].tex_coord.y = 1.0f;
+            quad[3].position.x = left;  quad[3].position.y = bottom; quad[3].tex_coord.x = u0; quad[3].tex_coord.y = 1.0f;
+            for (int v = 0; v < 4; v++) {
+                quad[v].color = color;
+            }
+
+            penX += GLYPH_CELL * dot;
+            count++;
+        }
+        SDL_RenderGeometry(game->renderer, glyphTexture, vertices, count * 4, indices, count * 6);
+    }
+}
@@ -1,15 +1,18 @@
 #include "chess_engine.h"
 
 bool initGame(ChessGame* game) {
+    // Log em segundo plano primeiro: registra também os erros de inicialização
+    startLogger(LOG_FILE_PATH);
+    
     // Inicializar SDL
     if (SDL_Init(SDL_INIT_VIDEO | SDL_INIT_AUDIO) < 0) {
-        printf("Erro ao inicializar SDL: %s\n", SDL_GetError());
+        LOG_ERROR("Erro ao inicializar SDL: %s", SDL_GetError());
         return false;
     }
     
     // Inicializar TTF
     if (TTF_Init() < 0) {
-        printf("Erro ao inicializar TTF: %s\n", TTF_GetError());
+        LOG_ERROR("Erro ao inicializar TTF: %s", TTF_GetError());
         return false;
     }
     
@@ -24,50 +27,52 @@ bool initGame(ChessGame* game) {
     );
     
     if (!game->window) {
-        printf("Erro ao criar janela: %s\n", SDL_GetError());
+        LOG_ERROR("Erro ao criar janela: %s", SDL_GetError());
         return false;
     }
     
-    // Criar renderer
+    // Criar renderer (a reprodução sem esperas não fica presa ao vsync)
+    bool fastReplay = game->trace.mode == INPUT_TRACE_REPLAY && game->trace.fast;
     game->renderer = SDL_CreateRenderer(
         game->window,
         -1,
-        SDL_RENDERER_ACCELERATED | SDL_RENDERER_PRESENTVSYNC
+        SDL_RENDERER_ACCELERATED | (fastReplay ? 0 : SDL_RENDERER_PRESENTVSYNC)
     );
     
     if (!game->renderer) {
-        printf("Erro ao criar renderer: %s\n", SDL_GetError());
+        LOG_ERROR("Erro ao criar renderer: %s", SDL_GetError());
         return false;
     }
     
-    // Carregar fontes
-    game->font = TTF_OpenFont("assets/fonts/arial.ttf", 16);
-    game->bigFont = TTF_OpenFont("assets/fonts/arial.ttf", 24);
-    
-    if (!game->font || !game->bigFont) {
-        printf("Erro ao carregar fontes. Usando fonte padrão.\n");
-        // Usar fonte padrão do sistema
-        game->font = TTF_OpenFont("C:/Windows/Fonts/arial.ttf", 16);
-        game->bigFont = TTF_OpenFont("C:/Windows/Fonts/arial.ttf", 24);
-    }
+    // Layout inicial: define o tamanho das casas e das fontes
+    int width, height;
+    SDL_GetWindowSize(game->window, &width, &height);
+    computeLayout(&game->layout, width, height);
     
-    // Inicializar áudio
-    initAudio(game);
+    // Inicializar áudio (só o dispositivo) e carregar fontes e sons em
+    // segundo plano; até lá o texto usa a fonte embutida
+    openAssetPack(ASSET_PACK_PATH);
+    bool audioReady = initAudio(game);
+    startAssetLoader(game, audioReady);
     
     // Inicializar tabuleiro
     initBoard(&game->board);
+    startGameRecord(game);
     
     // Configurações padrão
     game->running = true;
     game->showMoves = false;
     game->difficulty = 1;
-    game->score = 0;
+    game->routeLength = -1;
     strcpy(game->playerName, "Jogador");
     
     return true;
 }
 
 void cleanupGame(ChessGame* game) {
+    // O carregador pode ainda estar entregando assets
+    finishAssetLoader(game);
+    
     if (game->backgroundMusic) {
         Mix_FreeMusic(game->backgroundMusic);
     }
@@ -78,6 +83,11 @@ void cleanupGame(ChessGame* game) {
         Mix_FreeChunk(game->captureSound);
     }
     
+    destroyPieceAtlas(game);
+    destroyBoardLayer(game);
+    clearTextCache();
+    destroyFallbackFont();
+    
     if (game->font) {
         TTF_CloseFont(game->font);
     }
@@ -93,15 +103,49 @@ void cleanupGame(ChessGame* game) {
     }
     
     Mix_CloseAudio();
+    closeAssetPack();   // Fontes e música liam do mapeamento
+    stopLogger();
     TTF_Quit();
     SDL_Quit();
 }
 
+// Trata um evento e marca a tela para redesenho quando algo pode ter mudado
+static void processEvent(ChessGame* game, Menu* menu, SDL_Event* event) {
+    if (game->trace.mode == INPUT_TRACE_RECORD) {
+        recordInputEvent(game, event);
+    }
+    
+    if (event->type == SDL_QUIT) {
+        game->running = false;
+    }
+    
+    // Movimento do mouse só muda a tela quando atualiza a rota (handleGameInput)
+    if (event->type != SDL_MOUSEMOTION) {
+        game->needsRedraw = true;
+    }
+    
+    // O conteúdo de texturas alvo pode se perder (troca de dispositivo):
+    // refazer a camada do tabuleiro no próximo quadro
+    if (event->type == SDL_RENDER_TARGETS_RESET || event->type == SDL_RENDER_DEVICE_RESET) {
+        destroyBoardLayer(game);
+    }
+    
+    // Janela redimensionada: novo layout (e texturas na nova escala, se mudou)
+    if (event->type == SDL_WINDOWEVENT && event->window.event == SDL_WINDOWEVENT_SIZE_CHANGED) {
+        resizeLayout(game, event->window.data1, event->window.data2);
+    }
+    
+    if (menu->isActive) {
+        handleMenuInput(game, menu, event);
+    } else {
+        // Lógica de jogo baseada no módulo selecionado
+        handleGameInput(game, event);
+    }
+}
+
 void runGame(ChessGame* game) {
     SDL_Event event;
-    Uint32 lastTime = SDL_GetTicks();
-    Uint32 currentTime;
-    float deltaTime;
+    const Uint32 frameTime = 1000 / FPS;
     
     Menu mainMenu = {
         .selectedOption = 0,
@@ -113,24 +157,72 @@ void runGame(ChessGame* game) {
     strcpy(mainMenu.options[2], "Mestre - Algoritmo Recursivo");
     strcpy(mainMenu.options[3], "Sair");
     
+    game->needsRedraw = true;
+    startInputTrace(game);
+    bool replaying = game->trace.mode == INPUT_TRACE_REPLAY;
+    
     while (game->running) {
-        currentTime = SDL_GetTicks();
-        deltaTime = (currentTime - lastTime) / 1000.0f;
-        lastTime = currentTime;
+        bool searching = !mainMenu.isActive && game->visualizer.active && !game->visualizer.finished;
+        bool animating = updateAnimations(game) || searching;
+        animating = updateParticles() || animating;
         
-        // Processar eventos
-        while (SDL_PollEvent(&event)) {
-            if (event.type == SDL_QUIT) {
-                game->running = false;
+        // Assets chegando do carregador: aplicar e redesenhar
+        if (pollAssetLoader(game)) {
+            game->needsRedraw = true;
+        }
+        bool loading = isAssetLoaderRunning();
+        
+        // Sem nada para redesenhar nem animar: dormir até chegar um evento
+        // (na reprodução, até a hora do próximo evento gravado). Com assets
+        // ainda carregando a espera é curta para aplicá-los logo.
+        if (!game->needsRedraw && !animating) {
+            Uint32 wait = loading ? ASSET_POLL_INTERVAL_MS : IDLE_WAIT_MS;
+            if (replaying) {
+                SDL_Delay(MIN(getReplayDelay(game), wait));
+            } else if (SDL_WaitEventTimeout(&event, wait)) {
+                processEvent(game, &mainMenu, &event);
             }
-            
-            if (mainMenu.isActive) {
-                handleMenuInput(game, &mainMenu, &event);
-            } else {
-                // Lógica de jogo baseada no módulo selecionado
-                handleGameInput(game, &event);
+        }
+        
+        Uint32 frameStart = SDL_GetTicks();
+        Uint64 frameCounter = SDL_GetPerformanceCounter();
+        PROFILE_FRAME_BEGIN();
+        
+        // Processar eventos; na reprodução a entrada real é ignorada (exceto
+        // fechar a janela) e os eventos vêm da gravação, um por quadro com --fast
+        PROFILE_BEGIN(PROFILE_EVENTS);
+        while (SDL_PollEvent(&event)) {
+            if (!replaying || event.type == SDL_QUIT) {
+                processEvent(game, &mainMenu, &event);
             }
         }
+        while (replaying && nextReplayEvent(game, &event)) {
+            processEvent(game, &mainMenu, &event);
+            if (game->trace.fast) break;
+        }
+        if (isReplayFinished(game)) {
+            game->running = false;
+        }
+        PROFILE_END(PROFILE_EVENTS);
+        
+        // Avançar a busca visualizada só pelo tempo reservado ao quadro
+        if (searching) {
+            advanceVisualizer(&game->visualizer, game->visualizer.stepsPerFrame,
+                              VISUALIZER_BUDGET_MS);
+        }
+        if (animating) {
+            game->needsRedraw = true;
+        }
+        
+#ifdef PROFILING_ENABLED
+        // Com o perfilador ligado o HUD é atualizado continuamente
+        game->needsRedraw = true;
+#endif
+        
+        if (!game->needsRedraw) {
+            continue;
+        }
+        game->needsRedraw = false;
         
         // Renderizar
         SDL_SetRenderDrawColor(game->renderer, 30, 30, 30, 255);
@@ -139,64 +231,225 @@ void runGame(ChessGame* game) {
         if (mainMenu.isActive) {
             drawMenu(game, &mainMenu);
         } else {
+            PROFILE_BEGIN(PROFILE_BOARD);
             drawBoard(game);
+            drawVisualizer(game);
+            PROFILE_END(PROFILE_BOARD);
+            
+            PROFILE_BEGIN(PROFILE_UI);
             drawUI(game);
+            PROFILE_END(PROFILE_UI);
         }
+        PROFILE_DRAW_HUD(game);
         
+        PROFILE_BEGIN(PROFILE_PRESENT);
         SDL_RenderPresent(game->renderer);
+        PROFILE_END(PROFILE_PRESENT);
+        PROFILE_FRAME_END();
         
-        // Controle de FPS
-        if (deltaTime < 1.0f / FPS) {
-            SDL_Delay((Uint32)((1.0f / FPS - deltaTime) * 1000));
+        if (game->trace.mode != INPUT_TRACE_OFF) {
+            addFrameTime(&game->trace.stats, (double)(SDL_GetPerformanceCounter() - frameCounter) * 1000.0 /
+                                             (double)SDL_GetPerformanceFrequency());
         }
+        
+        // Controle de FPS: descontar o tempo gasto neste quadro, medido após desenhar
+        Uint32 elapsed = SDL_GetTicks() - frameStart;
+        if (elapsed < frameTime && !(replaying && game->trace.fast)) {
+            SDL_Delay(frameTime - elapsed);
+        }
+    }
+    
+    finishInputTrace(game);
+}
+
+// Explosão de partículas no centro da casa (velocidade em pixels de referência)
+static void emitAtSquare(ChessGame* game, Position square, SDL_Color color, int amount, float speed) {
+    SDL_Rect rect = getSquareRect(&game->layout, square.x, square.y);
+    emitParticles(rect.x + rect.w / 2.0f, rect.y + rect.h / 2.0f, color, amount,
+                  speed * game->layout.scale);
+}
+
+// Partículas do lance: captura, peão na última fileira (promoção) e mate
+static void emitMoveEffects(ChessGame* game, Piece moving, Piece captured, Position to) {
+    ChessBoard* board = &game->board;
+    
+    if (captured.type != PIECE_NONE) {
+        emitAtSquare(game, to, captured.color == COLOR_WHITE_PIECE ? COLOR_WHITE : COLOR_ATTACK,
+                     PARTICLES_CAPTURE, 250.0f);
+    }
+    if (moving.type == PIECE_PAWN && (to.y == 0 || to.y == BOARD_SIZE - 1)) {
+        emitAtSquare(game, to, COLOR_HIGHLIGHT, PARTICLES_PROMOTION, 300.0f);
+    }
+    if (getGameStatus(board) == GAME_CHECKMATE) {
+        emitAtSquare(game, findKing(board, board->currentPlayer), COLOR_HIGHLIGHT, PARTICLES_MATE, 450.0f);
     }
 }
 
+// Tabuleiro trocado de uma vez (reinício ou partida carregada): descartar
+// seleção, destaques e efeitos da posição anterior
+static void resetBoardView(ChessGame* game) {
+    game->board.isSelected = false;
+    game->showMoves = false;
+    invalidateMoveOverlay(game);
+    memset(game->animations, 0, sizeof(game->animations));
+    clearParticles();
+    game->routeLength = -1;
+    game->solverStatus[0] = '\0';     // A posição mudou: o mate achado não vale mais
+}
+
 void handleGameInput(ChessGame* game, SDL_Event* event) {
     if (event->type == SDL_MOUSEBUTTONDOWN) {
         if (event->button.button == SDL_BUTTON_LEFT) {
-            int mouseX = event->button.x;
-            int mouseY = event->button.y;
-            
             // Converter coordenadas do mouse para posição no tabuleiro
-            int boardX = (mouseX - 100) / SQUARE_SIZE;
-            int boardY = (mouseY - 100) / SQUARE_SIZE;
+            Position clickedPos;
             
-            if (boardX >= 0 && boardX < BOARD_SIZE && boardY >= 0 && boardY < BOARD_SIZE) {
-                Position clickedPos = {boardX, boardY};
-                
+            if (screenToBoard(&game->layout, event->button.x, event->button.y, &clickedPos)) {
                 if (!game->board.isSelected) {
-                    // Selecionar peça
+                    // Selecionar peça (só as do jogador da vez)
                     Piece* piece = getPieceAt(&game->board, clickedPos);
-                    if (piece && piece->type != PIECE_NONE) {
+                    if (piece && piece->type != PIECE_NONE && (int)piece->color == game->board.currentPlayer) {
                         game->board.selected = clickedPos;
                         game->board.isSelected = true;
                         game->showMoves = true;
+                        invalidateMoveOverlay(game);
+                        game->routeLength = -1;
                         playSound(game, game->moveSound);
                     }
                 } else {
-                    // Mover peça ou desselecionar
-                    if (isValidMove(&game->board, game->board.selected, clickedPos)) {
-                        makeMove(&game->board, game->board.selected, clickedPos);
-                        game->score += 10;
+                    // Mover peça ou desselecionar. Só lances legais entram no
+                    // histórico: o PGN exportado precisa ser lido de volta
+                    Piece moving = *getPieceAt(&game->board, game->board.selected);
+                    Piece captured = *getPieceAt(&game->board, clickedPos);
+                    Move move = {game->board.selected, clickedPos, PIECE_NONE};
+                    if (moving.type == PIECE_PAWN && (clickedPos.y == 0 || clickedPos.y == BOARD_SIZE - 1)) {
+                        move.promotion = PIECE_QUEEN;   // Mesma escolha de makeMove
+                    }
+                    if (isLegalMove(&game->board, move) && playRecordedMove(game, move)) {
+                        if (countRepetitions(game) >= 2) {
+                            LOG_INFO("Empate por repetição: a posição apareceu três vezes");
+                        }
+                        startMoveAnimation(game, moving, game->board.selected, clickedPos);
+                        emitMoveEffects(game, moving, captured, clickedPos);
                         playSound(game, game->captureSound);
+                        game->solverStatus[0] = '\0';
                     }
                     game->board.isSelected = false;
                     game->showMoves = false;
+                    invalidateMoveOverlay(game);
+                    game->routeLength = -1;
                 }
             }
         }
     }
     
+    // Mostrar a menor rota da peça selecionada até a casa sob o mouse
+    if (event->type == SDL_MOUSEMOTION && game->board.isSelected) {
+        Position hoverPos = {-1, -1};
+        bool onBoard = screenToBoard(&game->layout, event->motion.x, event->motion.y, &hoverPos);
+        
+        int previousLength = game->routeLength;
+        Position previousEnd = previousLength >= 0 ? game->route[previousLength] : hoverPos;
+        
+        if (onBoard) {
+            updateSelectedRoute(game, hoverPos);
+        } else {
+            game->routeLength = -1;
+        }
+        
+        // Redesenhar só se a rota mudou
+        if (game->routeLength != previousLength ||
+            (game->routeLength >= 0 && (game->route[game->routeLength].x != previousEnd.x ||
+                                        game->route[game->routeLength].y != previousEnd.y))) {
+            game->needsRedraw = true;
+        }
+    }
+    
     if (event->type == SDL_KEYDOWN) {
         switch (event->key.keysym.sym) {
             case SDLK_ESCAPE:
                 game->board.isSelected = false;
                 game->showMoves = false;
+                invalidateMoveOverlay(game);
+                game->routeLength = -1;
+                game->visualizer.active = false;
                 break;
             case SDLK_r:
                 initBoard(&game->board);
-                game->score = 0;
+                startGameRecord(game);
+                resetBoardView(game);
+                break;
+            case SDLK_z:
+                // Desfazer e refazer lances pelo histórico da partida
+                if (undoRecordedMove(game)) {
+                    resetBoardView(game);
+                }
+                break;
+            case SDLK_y:
+                if (redoRecordedMove(game)) {
+                    resetBoardView(game);
+                }
+                break;
+            case SDLK_F5:
+                // Salvar e carregar a partida completa (posição, lances e contadores)
+                if (saveGame(game, SAVE_GAME_FILE)) {
+                    LOG_INFO("Partida salva em %s", SAVE_GAME_FILE);
+                }
+                break;
+            case SDLK_F9:
+                if (loadGame(game, SAVE_GAME_FILE)) {
+                    resetBoardView(game);
+                }
+                break;
+            case SDLK_F6:
+                // Exportar PGN (e a posição atual em FEN) / importar PGN ou FEN
+                if (exportPGN(game, SAVE_PGN_FILE, SAVE_FEN_FILE)) {
+                    LOG_INFO("Partida exportada em %s", SAVE_PGN_FILE);
+                }
+                break;
+            case SDLK_F7: {
+                // A FEN só entra sem um PGN exportado; PGN inválido fica no log
+                FILE* pgn = fopen(SAVE_PGN_FILE, "rb");
+                if (pgn) fclose(pgn);
+                if (importPGN(game, pgn ? SAVE_PGN_FILE : SAVE_FEN_FILE)) {
+                    resetBoardView(game);
+                }
+                break;
+            }
+            case SDLK_v:
+                // Aventureiro e Mestre: visualizar as buscas do cavalo passo a passo
+                // (recursiva -> memoização -> BFS -> desligado)
+                if (game->difficulty >= 2) {
+                    SearchVisualizer* vis = &game->visualizer;
+                    if (vis->active && vis->algorithm == SEARCH_ALGORITHM_COUNT - 1) {
+                        vis->active = false;
+                    } else {
+                        SearchAlgorithm next = vis->active ? (SearchAlgorithm)(vis->algorithm + 1) : SEARCH_RECURSIVE;
+                        Position start = {0, 0};
+                        Position target = {BOARD_SIZE - 1, BOARD_SIZE - 1};
+                        if (game->board.isSelected) {
+                            start = game->board.selected;
+                        }
+                        startVisualizer(vis, next, start, target);
+                    }
+                }
+                break;
+            case SDLK_PLUS:
+            case SDLK_EQUALS:
+                // Acelerar ou desacelerar a busca visualizada
+                if (game->visualizer.stepsPerFrame < (1 << 20)) {
+                    game->visualizer.stepsPerFrame *= 2;
+                }
+                break;
+            case SDLK_MINUS:
+                if (game->visualizer.stepsPerFrame > 1) {
+                    game->visualizer.stepsPerFrame /= 2;
+                }
+                break;
+            case SDLK_m:
+                // Modo Mestre: procurar mate em até 3 lances na posição atual
+                if (game->difficulty == 3) {
+                    solveMestrePosition(game, 3);
+                }
                 break;
         }
     }
@@ -0,0 +1,101 @@
+#include "chess_engine.h"
+
+// Histórico da partida jogada na interface
+// Vetores pré-alocados de MAX_MOVES lances: para cada lance ficam o próprio
+// lance, o registro de desfazer (applyMove/undoMove) e o hash da posição
+// resultante. Desfazer e refazer só movem o índice count e tocam as casas
+// envolvidas no lance; o tabuleiro nunca é copiado. Os lances entre count e
+// total continuam disponíveis para refazer até um lance novo os substituir.
+// Os pontos do jogador vêm do número de lances registrados, então desfazer
+// e refazer também os acompanham.
+
+static void updateScore(ChessGame* game) {
+    game->score = game->record.count * SCORE_PER_MOVE;
+}
+
+// A partida começa de novo a partir da posição atual do tabuleiro
+void startGameRecord(ChessGame* game) {
+    GameRecord* record = &game->record;
+    record->start = game->board;
+    record->count = 0;
+    record->total = 0;
+    record->hashes[0] = computeBoardHash(&game->board);
+    updateScore(game);
+}
+
+static void pushRecordedMove(GameRecord* record, ChessBoard* board, Move move) {
+    int ply = record->count;
+    applyMove(board, move, &record->undo[ply]);
+    record->moves[ply] = move;
+    record->hashes[ply + 1] = computeBoardHash(board);
+    record->count = ply + 1;
+}
+
+// Joga o lance no tabuleiro e o registra; um lance novo descarta os lances
+// que podiam ser refeitos. Com o histórico cheio o lance é recusado: jogado
+// sem registro, ele não poderia ser desfeito, salvo nem exportado.
+bool playRecordedMove(ChessGame* game, Move move) {
+    GameRecord* record = &game->record;
+    if (record->count >= MAX_MOVES) {
+        LOG_WARN("Histórico cheio (%d lances): lance recusado", MAX_MOVES);
+        return false;
+    }
+    pushRecordedMove(record, &game->board, move);
+    record->total = record->count;
+    updateScore(game);
+    return true;
+}
+
+bool undoRecordedMove(ChessGame* game) {
+    GameRecord* record = &game->record;
+    if (record->count == 0) {
+        return false;
+    }
+    record->count--;
+    undoMove(&game->board, &record->undo[record->count]);
+    updateScore(game);
+    return true;
+}
+
+bool redoRecordedMove(ChessGame* game) {
+    GameRecord* record = &game->record;
+    if (record->count >= record->total) {
+        return false;
+    }
+    pushRecordedMove(record, &game->board, record->moves[record->count]);
+    updateScore(game);
+    return true;
+}
+
+// Refaz o tabuleiro a partir de record.start e dos count lances de
+// record.moves (partida carregada ou importada)
+void replayGameRecord(ChessGame* game) {
+    GameRecord* record = &game->record;
+    int count = record->count;
+
+    game->board = record->start;
+    record->count = 0;
+    record->hashes[0] = computeBoardHash(&game->board);
+    for (int i = 0; i < count; i++) {
+        pushRecordedMove(record, &game->board, record->moves[i]);
+    }
+    record->total = count;
+    updateScore(game);
+}
+
+// Quantas vezes a posição atual já apareceu antes. Só os lances desde a
+// última captura ou lance de peão (halfmoveClock) podem repetir a posição,
+// e só com o mesmo lado a jogar, então a busca anda de dois em dois.
+int countRepetitions(ChessGame* game) {
+    GameRecord* record = &game->record;
+    int window = game->board.halfmoveClock < record->count ? game->board.halfmoveClock : record->count;
+    Uint64 current = record->hashes[record->count];
+    int repetitions = 0;
+
+    for (int back = 2; back <= window; back += 2) {
+        if (record->hashes[record->count - back] == current) {
+            repetitions++;
+        }
+    }
+    return repetitions;
+}
@@ -0,0 +1,216 @@
+#include "chess_engine.h"
+
+// Gravação e reprodução da entrada
+// --record grava, com o tempo desde o início de runGame, os eventos que o
+// jogo trata (teclas, mouse, redimensionamento e saída) em registros de 16
+// bytes. --replay lê o arquivo e entrega os mesmos eventos a
+// handleMenuInput/handleGameInput no tempo gravado ou, com --fast, um por
+// quadro sem esperar. Nos dois modos o tempo de cada quadro desenhado entra
+// num histograma, resumido no fim da sessão.
+
+#define INPUT_TRACE_BYTE_ORDER 0x0102
+
+typedef struct {
+    char magic[4];              // "MCIT"
+    Uint16 version;
+    Uint16 byteOrder;
+    Uint16 recordSize;
+    Uint16 reserved;
+    Sint32 width, height;       // Janela no início da gravação
+} InputTraceHeader;
+
+typedef char inputRecordIsCompact[sizeof(InputRecord) == 16 ? 1 : -1];
+
+static bool readNextRecord(InputTrace* trace) {
+    trace->hasNext = fread(&trace->next, sizeof(trace->next), 1, trace->file) == 1;
+    return trace->hasNext;
+}
+
+static void resetFrameStats(FrameStats* stats) {
+    memset(stats, 0, sizeof(*stats));
+    stats->minMs = 1e9;
+}
+
+bool startInputTrace(ChessGame* game) {
+    InputTrace* trace = &game->trace;
+    InputTraceHeader header;
+    resetFrameStats(&trace->stats);
+    trace->events = 0;
+    trace->hasNext = false;
+    trace->startTime = SDL_GetTicks();
+
+    if (trace->mode == INPUT_TRACE_RECORD) {
+        trace->file = fopen(trace->path, "wb");
+        if (!trace->file) {
+            LOG_ERROR("Erro ao criar %s", trace->path);
+            trace->mode = INPUT_TRACE_OFF;
+            return false;
+        }
+        memset(&header, 0, sizeof(header));
+        memcpy(header.magic, "MCIT", 4);
+        header.version = INPUT_TRACE_VERSION;
+        header.byteOrder = INPUT_TRACE_BYTE_ORDER;
+        header.recordSize = (Uint16)sizeof(InputRecord);
+        header.width = game->layout.width;
+        header.height = game->layout.height;
+        fwrite(&header, sizeof(header), 1, trace->file);
+        LOG_INFO("Gravando a entrada em %s", trace->path);
+        return true;
+    }
+
+    if (trace->mode == INPUT_TRACE_REPLAY) {
+        trace->file = fopen(trace->path, "rb");
+        if (!trace->file || fread(&header, sizeof(header), 1, trace->file) != 1 ||
+            memcmp(header.magic, "MCIT", 4) != 0 || header.version != INPUT_TRACE_VERSION ||
+            header.byteOrder != INPUT_TRACE_BYTE_ORDER || header.recordSize != sizeof(InputRecord)) {
+            LOG_ERROR("Gravação de entrada inválida: %s", trace->path);
+            if (trace->file) fclose(trace->file);
+            trace->file = NULL;
+            trace->mode = INPUT_TRACE_OFF;
+            return false;
+        }
+        // Mesma janela da gravação: os cliques caem nas mesmas casas
+        if (game->window) {
+            SDL_SetWindowSize(game->window, header.width, header.height);
+        }
+        resizeLayout(game, header.width, header.height);
+        readNextRecord(trace);
+        LOG_INFO("Reproduzindo %s%s", trace->path, trace->fast ? " (sem esperas)" : "");
+        return true;
+    }
+    return true;
+}
+
+void recordInputEvent(ChessGame* game, const SDL_Event* event) {
+    InputTrace* trace = &game->trace;
+    InputRecord record;
+    memset(&record, 0, sizeof(record));
+    record.time = SDL_GetTicks() - trace->startTime;
+    record.type = (Uint16)event->type;
+
+    switch (event->type) {
+        case SDL_QUIT:
+            break;
+        case SDL_KEYDOWN:
+        case SDL_KEYUP:
+            record.a = event->key.keysym.sym;
+            record.b = event->key.keysym.mod;
+            break;
+        case SDL_MOUSEBUTTONDOWN:
+        case SDL_MOUSEBUTTONUP:
+            record.detail = event->button.button;
+            record.a = event->button.x;
+            record.b = event->button.y;
+            break;
+        case SDL_MOUSEMOTION:
+            record.a = event->motion.x;
+            record.b = event->motion.y;
+            break;
+        case SDL_WINDOWEVENT:
+            if (event->window.event != SDL_WINDOWEVENT_SIZE_CHANGED) return;
+            record.detail = event->window.event;
+            record.a = event->window.data1;
+            record.b = event->window.data2;
+            break;
+        default:
+            return;     // Eventos que o jogo não trata não afetam a sessão
+    }
+    fwrite(&record, sizeof(record), 1, trace->file);
+    trace->events++;
+}
+
+// Tempo até o próximo evento gravado (0 = já está na hora)
+Uint32 getReplayDelay(ChessGame* game) {
+    InputTrace* trace = &game->trace;
+    Uint32 now = SDL_GetTicks() - trace->startTime;
+    if (trace->fast || !trace->hasNext || trace->next.time <= now) {
+        return 0;
+    }
+    return trace->next.time - now;
+}
+
+// Monta o próximo SDL_Event da gravação, se já for a hora dele
+bool nextReplayEvent(ChessGame* game, SDL_Event* event) {
+    InputTrace* trace = &game->trace;
+    if (!trace->hasNext || getReplayDelay(game) > 0) {
+        return false;
+    }
+
+    InputRecord* record = &trace->next;
+    memset(event, 0, sizeof(*event));
+    event->type = record->type;
+    switch (record->type) {
+        case SDL_KEYDOWN:
+        case SDL_KEYUP:
+            event->key.keysym.sym = record->a;
+            event->key.keysym.mod = (Uint16)record->b;
+            break;
+        case SDL_MOUSEBUTTONDOWN:
+        case SDL_MOUSEBUTTONUP:
+            event->button.button = record->detail;
+            event->button.x = record->a;
+            event->button.y = record->b;
+            break;
+        case SDL_MOUSEMOTION:
+            event->motion.x = record->a;
+            event->motion.y = record->b;
+            break;
+        case SDL_WINDOWEVENT:
+            event->window.event = record->detail;
+            event->window.data1 = record->a;
+            event->window.data2 = record->b;
+            if (game->window) {
+                SDL_SetWindowSize(game->window, record->a, record->b);
+            }
+            break;
+    }
+    trace->events++;
+    readNextRecord(trace);
+    return true;
+}
+
+bool isReplayFinished(ChessGame* game) {
+    return game->trace.mode == INPUT_TRACE_REPLAY && !game->trace.hasNext;
+}
+
+void addFrameTime(FrameStats* stats, double ms) {
+    int bucket = (int)(ms * 10.0);
+    if (bucket > FRAME_HISTOGRAM_BUCKETS) bucket = FRAME_HISTOGRAM_BUCKETS;
+    stats->histogram[bucket]++;
+    stats->frames++;
+    stats->totalMs += ms;
+    if (ms < stats->minMs) stats->minMs = ms;
+    if (ms > stats->maxMs) stats->maxMs = ms;
+}
+
+static double framePercentile(const FrameStats* stats, double fraction) {
+    long long wanted = (long long)(stats->frames * fraction);
+    long long seen = 0;
+    for (int i = 0; i <= FRAME_HISTOGRAM_BUCKETS; i++) {
+        seen += stats->histogram[i];
+        if (seen > wanted) return (i + 1) / 10.0;
+    }
+    return stats->maxMs;
+}
+
+void finishInputTrace(ChessGame* game) {
+    InputTrace* trace = &game->trace;
+    if (trace->mode == INPUT_TRACE_OFF) {
+        return;
+    }
+    if (trace->file) {
+        fclose(trace->file);
+        trace->file = NULL;
+    }
+
+    FrameStats* stats = &trace->stats;
+    double seconds = (SDL_GetTicks() - trace->startTime) / 1000.0;
+    LOG_INFO("%s: %lld eventos em %.2f s", trace->mode == INPUT_TRACE_RECORD ? "Gravação" : "Reprodução",
+             trace->events, seconds);
+    if (stats->frames > 0) {
+        LOG_INFO("Quadros: %lld, média %.2f ms, mín %.2f ms, máx %.2f ms",
+                 stats->frames, stats->totalMs / stats->frames, stats->minMs, stats->maxMs);
+        LOG_INFO("Percentis: p50 %.1f ms, p95 %.1f ms, p99 %.1f ms",
+                 framePercentile(stats, 0.50), framePercentile(stats, 0.95), framePercentile(stats, 0.99));
+    }
+}
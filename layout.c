@@ -0,0 +1,109 @@
+#include "chess_engine.h"
+
+// Layout independente de resolução
+// Tudo o que depende do tamanho da janela é calculado aqui uma vez por
+// redimensionamento. Quando a escala muda, fontes, atlas de peças, camada do
+// tabuleiro e cache de texto são refeitos na nova resolução (e não esticados
+// a cada quadro).
+
+#define MIN_FONT_SIZE 8
+
+int layoutScaled(const Layout* layout, int value) {
+    return (int)(value * layout->scale + 0.5f);
+}
+
+void computeLayout(Layout* layout, int width, int height) {
+    float scaleX = (float)width / WINDOW_WIDTH;
+    float scaleY = (float)height / WINDOW_HEIGHT;
+
+    layout->width = width;
+    layout->height = height;
+    layout->scale = scaleX < scaleY ? scaleX : scaleY;
+
+    // Painel à direita; o tabuleiro ocupa o maior quadrado que cabe no resto
+    layout->panelWidth = layoutScaled(layout, PANEL_WIDTH);
+    layout->panelX = width - layout->panelWidth;
+
+    int margin = layoutScaled(layout, BOARD_MARGIN);
+    int areaWidth = layout->panelX - 2 * margin;
+    int areaHeight = height - 2 * margin;
+    int side = areaWidth < areaHeight ? areaWidth : areaHeight;
+
+    layout->squareSize = side / BOARD_SIZE;
+    if (layout->squareSize < 1) {
+        layout->squareSize = 1;
+    }
+    layout->boardX = (layout->panelX - layout->squareSize * BOARD_SIZE) / 2;
+    layout->boardY = (height - layout->squareSize * BOARD_SIZE) / 2;
+
+    layout->fontSize = layoutScaled(layout, 16);
+    layout->bigFontSize = layoutScaled(layout, 24);
+    if (layout->fontSize < MIN_FONT_SIZE) layout->fontSize = MIN_FONT_SIZE;
+    if (layout->bigFontSize < MIN_FONT_SIZE) layout->bigFontSize = MIN_FONT_SIZE;
+}
+
+// (Re)abre as fontes de game->fontPath (pacote ou disco) no tamanho do layout atual
+bool openFonts(ChessGame* game) {
+    if (game->font) {
+        TTF_CloseFont(game->font);
+    }
+    if (game->bigFont) {
+        TTF_CloseFont(game->bigFont);
+    }
+
+    game->font = TTF_OpenFontRW(openAsset(game->fontPath), 1, game->layout.fontSize);
+    game->bigFont = TTF_OpenFontRW(openAsset(game->fontPath), 1, game->layout.bigFontSize);
+    return game->font && game->bigFont;
+}
+
+void resizeLayout(ChessGame* game, int width, int height) {
+    Layout previous = game->layout;
+    computeLayout(&game->layout, width, height);
+
+    // As posições mudaram: os retângulos dos destaques são recalculados
+    invalidateMoveOverlay(game);
+
+    if (game->layout.fontSize != previous.fontSize ||
+        game->layout.bigFontSize != previous.bigFontSize) {
+        // O cache é chaveado pelo ponteiro da fonte: esvaziar antes de fechá-la
+        clearTextCache();
+        if (game->fontPath) {
+            openFonts(game);
+        }
+        destroyPieceAtlas(game);    // Os símbolos das peças usam a fonte
+    }
+
+    if (game->layout.squareSize != previous.squareSize) {
+        destroyPieceAtlas(game);
+        destroyBoardLayer(game);
+    }
+}
+
+SDL_Rect getSquareRect(const Layout* layout, int x, int y) {
+    SDL_Rect rect = {
+        layout->boardX + x * layout->squareSize,
+        layout->boardY + y * layout->squareSize,
+        layout->squareSize,
+        layout->squareSize
+    };
+    return rect;
+}
+
+// Converte um ponto da janela na casa sob ele (a inversa de getSquareRect)
+bool screenToBoard(const Layout* layout, int pixelX, int pixelY, Position* pos) {
+    int offsetX = pixelX - layout->boardX;
+    int offsetY = pixelY - layout->boardY;
+    if (offsetX < 0 || offsetY < 0) {
+        return false;
+    }
+
+    pos->x = offsetX / layout->squareSize;
+    pos->y = offsetY / layout->squareSize;
+    return isPositionValid(*pos);
+}
+
+// Texto do painel lateral; y é a coordenada de referência
+void drawPanelText(ChessGame* game, const char* text, int y, SDL_Color color) {
+    drawText(game, text, game->layout.panelX + layoutScaled(&game->layout, PANEL_PADDING),
+             layoutScaled(&game->layout, y), color);
+}
@@ -0,0 +1,255 @@
+#ifndef _WIN32
+#define _POSIX_C_SOURCE 200809L     // mkdir, open e writev com -std=c99
+#endif
+
+#include "chess_engine.h"
+
+#include <stdarg.h>
+#include <fcntl.h>
+
+#ifdef _WIN32
+#include <direct.h>
+#include <io.h>
+#else
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#endif
+
+// Log assíncrono
+// Cada thread que registra mensagens ganha um buffer circular próprio
+// (um produtor, um consumidor): formatar a mensagem e avançar o índice head
+// é tudo o que ela faz, sem trava nem chamada de sistema. Uma thread de
+// fundo esvazia os buffers e grava em lotes com writev. Com o buffer cheio
+// a mensagem é descartada e contada; quem registra nunca espera o disco.
+
+#define LOG_WRITE_BATCH 64          // Mensagens por chamada de writev
+#define LOG_PREFIX_LENGTH 19        // "[   123.456] INFO  "
+
+typedef struct {
+    Uint16 length;                  // Bytes de text, com prefixo e '\n'
+    char text[LOG_ENTRY_SIZE - 2];
+} LogEntry;
+
+typedef struct {
+    SDL_atomic_t state;             // LOG_RING_FREE, _OWNED ou _RELEASED
+    SDL_atomic_t head;              // Escrito só pela thread dona
+    char padding[56];               // head e tail em linhas de cache diferentes
+    SDL_atomic_t tail;              // Escrito só pelo escritor
+    LogEntry entries[LOG_RING_ENTRIES];
+} LogRing;
+
+enum { LOG_RING_FREE = 0, LOG_RING_OWNED, LOG_RING_RELEASED };
+
+typedef char logRingEntriesArePowerOfTwo[(LOG_RING_ENTRIES & (LOG_RING_ENTRIES - 1)) == 0 ? 1 : -1];
+
+#ifdef _WIN32
+struct iovec {
+    void* iov_base;
+    size_t iov_len;
+};
+
+static int writev(int fd, const struct iovec* chunks, int count) {
+    for (int i = 0; i < count; i++) {
+        if (_write(fd, chunks[i].iov_base, (unsigned int)chunks[i].iov_len) < 0) return -1;
+    }
+    return 0;
+}
+#define open _open
+#define close _close
+#define STDOUT_FILENO 1
+#endif
+
+static LogRing logRings[LOG_MAX_THREADS];
+static SDL_TLSID logRingKey;
+static SDL_Thread* logWriter;
+static SDL_atomic_t logRunning;
+static SDL_atomic_t logDropped;
+static int logFile = -1;
+
+static const char* const levelNames[] = {"DEBUG", "INFO ", "AVISO", "ERRO "};
+
+// Fim da thread: o escritor esvazia o buffer antes de liberá-lo para outra
+static void releaseLogRing(void* data) {
+    LogRing* ring = (LogRing*)data;
+    SDL_AtomicSet(&ring->state, LOG_RING_RELEASED);
+}
+
+static LogRing* claimLogRing(void) {
+    LogRing* ring = (LogRing*)SDL_TLSGet(logRingKey);
+    if (ring) {
+        return ring;
+    }
+    for (int i = 0; i < LOG_MAX_THREADS; i++) {
+        if (SDL_AtomicCAS(&logRings[i].state, LOG_RING_FREE, LOG_RING_OWNED)) {
+            SDL_TLSSet(logRingKey, &logRings[i], releaseLogRing);
+            return &logRings[i];
+        }
+    }
+    return NULL;
+}
+
+// Grava as mensagens prontas de todos os buffers; retorna quantas gravou
+static int drainLogRings(void) {
+    struct iovec fileChunks[LOG_WRITE_BATCH];
+#if LOG_ECHO_CONSOLE
+    struct iovec consoleChunks[LOG_WRITE_BATCH];
+#endif
+    int written = 0;
+
+    for (int i = 0; i < LOG_MAX_THREADS; i++) {
+        LogRing* ring = &logRings[i];
+        int state = SDL_AtomicGet(&ring->state);
+        if (state == LOG_RING_FREE) continue;
+
+        unsigned int tail = (unsigned int)SDL_AtomicGet(&ring->tail);
+        unsigned int head = (unsigned int)SDL_AtomicGet(&ring->head);
+        SDL_MemoryBarrierAcquire();     // Mensagens completas até head
+        while (tail != head) {
+            int count = 0;
+            while (tail + count != head && count < LOG_WRITE_BATCH) {
+                LogEntry* entry = &ring->entries[(tail + count) & (LOG_RING_ENTRIES - 1)];
+                fileChunks[count].iov_base = entry->text;
+                fileChunks[count].iov_len = entry->length;
+#if LOG_ECHO_CONSOLE
+                consoleChunks[count].iov_base = entry->text + LOG_PREFIX_LENGTH;
+                consoleChunks[count].iov_len = (size_t)entry->length - LOG_PREFIX_LENGTH;
+#endif
+                count++;
+            }
+            if (logFile >= 0) {
+                writev(logFile, fileChunks, count);
+            }
+#if LOG_ECHO_CONSOLE
+            writev(STDOUT_FILENO, consoleChunks, count);
+#endif
+            tail += count;
+            written += count;
+            SDL_AtomicSet(&ring->tail, (int)tail);
+        }
+
+        // A thread terminou e tudo o que ela registrou já foi gravado
+        if (state == LOG_RING_RELEASED && (unsigned int)SDL_AtomicGet(&ring->head) == tail) {
+            SDL_AtomicSet(&ring->state, LOG_RING_FREE);
+        }
+    }
+    return written;
+}
+
+static int logWriterMain(void* data) {
+    (void)data;
+    while (SDL_AtomicGet(&logRunning)) {
+        if (drainLogRings() == 0) {
+            SDL_Delay(LOG_FLUSH_INTERVAL_MS);
+        }
+    }
+    drainLogRings();
+    return 0;
+}
+
+// Abre o arquivo (criando a pasta) e inicia o escritor. Sem o log aberto as
+// mensagens vão direto para o terminal.
+bool startLogger(const char* path) {
+    if (SDL_AtomicGet(&logRunning)) {
+        return true;
+    }
+
+    char directory[MAX_FILENAME_LENGTH + 1];
+    const char* slash = strrchr(path, '/');
+    if (slash && (size_t)(slash - path) < sizeof(directory)) {
+        memcpy(directory, path, (size_t)(slash - path));
+        directory[slash - path] = '\0';
+#ifdef _WIN32
+        _mkdir(directory);
+#else
+        mkdir(directory, 0755);
+#endif
+    }
+    logFile = open(path, O_WRONLY | O_CREAT | O_APPEND, 0644);
+    if (logFile < 0) {
+        printf("Aviso: não foi possível abrir %s; log só no terminal\n", path);
+    }
+
+    if (!logRingKey) {
+        logRingKey = SDL_TLSCreate();
+    }
+    fflush(stdout);     // O eco no terminal escreve direto no descritor
+    SDL_AtomicSet(&logDropped, 0);
+    SDL_AtomicSet(&logRunning, 1);
+    logWriter = SDL_CreateThread(logWriterMain, "matecheck-log", NULL);
+    if (!logWriter) {
+        SDL_AtomicSet(&logRunning, 0);
+        if (logFile >= 0) close(logFile);
+        logFile = -1;
+        return false;
+    }
+    return true;
+}
+
+// Grava o que ainda está nos buffers e fecha o arquivo
+void stopLogger(void) {
+    if (!SDL_AtomicGet(&logRunning)) {
+        return;
+    }
+    SDL_AtomicSet(&logRunning, 0);
+    SDL_WaitThread(logWriter, NULL);
+    logWriter = NULL;
+
+    int dropped = SDL_AtomicGet(&logDropped);
+    if (dropped > 0 && logFile >= 0) {
+        char text[64];
+        int length = snprintf(text, sizeof(text), "%d mensagens descartadas (buffer cheio)\n", dropped);
+        struct iovec chunk = {text, (size_t)length};
+        writev(logFile, &chunk, 1);
+    }
+    if (logFile >= 0) {
+        close(logFile);
+        logFile = -1;
+    }
+}
+
+int getDroppedLogCount(void) {
+    return SDL_AtomicGet(&logDropped);
+}
+
+void logMessage(LogLevel level, const char* format, ...) {
+    va_list args;
+    va_start(args, format);
+
+    LogRing* ring = SDL_AtomicGet(&logRunning) ? claimLogRing() : NULL;
+    if (!ring) {
+        // Sem escritor (ferramentas, testes) ou sem buffer livre
+        if (SDL_AtomicGet(&logRunning)) {
+            SDL_AtomicAdd(&logDropped, 1);
+        } else {
+            vprintf(format, args);
+            putchar('\n');
+        }
+        va_end(args);
+        return;
+    }
+
+    unsigned int head = (unsigned int)SDL_AtomicGet(&ring->head);
+    if (head - (unsigned int)SDL_AtomicGet(&ring->tail) >= LOG_RING_ENTRIES) {
+        SDL_AtomicAdd(&logDropped, 1);
+        va_end(args);
+        return;
+    }
+
+    LogEntry* entry = &ring->entries[head & (LOG_RING_ENTRIES - 1)];
+    Uint32 ticks = SDL_GetTicks();
+    snprintf(entry->text, LOG_PREFIX_LENGTH + 1, "[%6u.%03u] %s ",
+             (unsigned)(ticks / 1000) % 1000000, (unsigned)(ticks % 1000), levelNames[level]);
+    int length = vsnprintf(entry->text + LOG_PREFIX_LENGTH, sizeof(entry->text) - LOG_PREFIX_LENGTH - 1,
+                           format, args);
+    va_end(args);
+
+    int limit = (int)sizeof(entry->text) - LOG_PREFIX_LENGTH - 2;
+    if (length < 0) length = 0;
+    if (length > limit) length = limit;     // Mensagem longa demais: cortada
+    entry->text[LOG_PREFIX_LENGTH + length] = '\n';
+    entry->length = (Uint16)(LOG_PREFIX_LENGTH + length + 1);
+
+    SDL_MemoryBarrierRelease();     // Texto visível antes do novo head
+    SDL_AtomicSet(&ring->head, (int)(head + 1));
+}
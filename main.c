@@ -3,7 +3,24 @@
 int main(int argc, char* argv[]) {
     ChessGame game = {0};
     
+    // Sessões repetíveis: --record grava a entrada, --replay a reproduz
+    for (int i = 1; i < argc; i++) {
+        if (i + 1 < argc && strcmp(argv[i], "--record") == 0) {
+            game.trace.mode = INPUT_TRACE_RECORD;
+            game.trace.path = argv[++i];
+        } else if (i + 1 < argc && strcmp(argv[i], "--replay") == 0) {
+            game.trace.mode = INPUT_TRACE_REPLAY;
+            game.trace.path = argv[++i];
+        } else if (strcmp(argv[i], "--fast") == 0) {
+            game.trace.fast = true;
+        } else {
+            printf("Uso: matecheck [--record arquivo | --replay arquivo [--fast]]\n");
+            return 1;
+        }
+    }
+    
     if (!initGame(&game)) {
+        stopLogger();   // Gravar os erros já registrados
         printf("Erro ao inicializar o jogo!\n");
         return 1;
     }
@@ -4,19 +4,19 @@
 // Demonstra loops aninhados para movimento em "L"
 
 void runAventureiroModule(ChessGame* game) {
-    printf("=== MÓDULO AVENTUREIRO ===\n");
-    printf("Aprenda o movimento em 'L' do Cavalo usando loops aninhados\n");
-    printf("Conceitos: loops aninhados, validação de limites\n\n");
+    LOG_INFO("=== MÓDULO AVENTUREIRO ===");
+    LOG_INFO("Aprenda o movimento em 'L' do Cavalo usando loops aninhados");
+    LOG_INFO("Conceitos: loops aninhados, validação de limites");
     
     // Configurar tabuleiro para demonstração
     initAventureiroBoard(&game->board);
     
     // Demonstração do Cavalo
-    printf("--- MOVIMENTOS DO CAVALO ---\n");
+    LOG_INFO("--- MOVIMENTOS DO CAVALO ---");
     demonstrateKnightMoves(game);
     
     // Demonstração de loops aninhados
-    printf("\n--- LOOPS ANINHADOS ---\n");
+    LOG_INFO("--- LOOPS ANINHADOS ---");
     demonstrateNestedLoops(game);
 }
 
@@ -39,10 +39,10 @@ void initAventureiroBoard(ChessBoard* board) {
 
 void demonstrateKnightMoves(ChessGame* game) {
     Position knightPos = {3, 3};
-    printf("Cavalo na posição (%d, %d):\n", knightPos.x, knightPos.y);
+    LOG_INFO("Cavalo na posição (%d, %d):", knightPos.x, knightPos.y);
     
     // Usando loops aninhados para encontrar movimentos em "L"
-    printf("Movimentos possíveis (usando loops aninhados):\n");
+    LOG_INFO("Movimentos possíveis (usando loops aninhados):");
     
     // Array de deslocamentos para movimento em "L"
     int knightMoves[8][2] = {
@@ -57,31 +57,29 @@ void demonstrateKnightMoves(ChessGame* game) {
         
         // Validação de limites usando função auxiliar
         if (isPositionValid((Position){newX, newY})) {
-            printf("  Cavalo pode mover para (%d, %d)\n", newX, newY);
+            LOG_DEBUG("  Cavalo pode mover para (%d, %d)", newX, newY);
         } else {
-            printf("  Movimento para (%d, %d) está fora do tabuleiro\n", newX, newY);
+            LOG_DEBUG("  Movimento para (%d, %d) está fora do tabuleiro", newX, newY);
         }
     }
 }
 
 void demonstrateNestedLoops(ChessGame* game) {
-    printf("Demonstração de loops aninhados:\n");
-    printf("Simulando busca em uma matriz 3x3:\n");
+    LOG_INFO("Demonstração de loops aninhados:");
+    LOG_INFO("Simulando busca em uma matriz 3x3:");
     
     // Loop aninhado para percorrer uma matriz
     for (int i = 0; i < 3; i++) {
         for (int j = 0; j < 3; j++) {
-            printf("  Posição [%d][%d] = %d\n", i, j, i * 3 + j);
+            LOG_DEBUG("  Posição [%d][%d] = %d", i, j, i * 3 + j);
         }
     }
     
-    printf("\nSimulando movimento do cavalo em todas as posições:\n");
+    LOG_INFO("Simulando movimento do cavalo em todas as posições:");
     
     // Loop aninhado para testar cavalo em diferentes posições
     for (int startX = 0; startX < 3; startX++) {
         for (int startY = 0; startY < 3; startY++) {
-            printf("Cavalo em (%d, %d): ", startX, startY);
-            
             // Contar movimentos válidos
             int validMoves = 0;
             int knightMoves[8][2] = {
@@ -98,20 +96,20 @@ void demonstrateNestedLoops(ChessGame* game) {
                 }
             }
             
-            printf("%d movimentos válidos\n", validMoves);
+            LOG_INFO("Cavalo em (%d, %d): %d movimentos válidos", startX, startY, validMoves);
         }
     }
 }
 
 void demonstrateKnightPathfinding(ChessGame* game) {
-    printf("\n--- ALGORITMO DE BUSCA DO CAVALO ---\n");
-    printf("Encontrando caminho do cavalo entre duas posições:\n");
+    LOG_INFO("--- ALGORITMO DE BUSCA DO CAVALO ---");
+    LOG_INFO("Encontrando caminho do cavalo entre duas posições:");
     
     Position start = {0, 0};
     Position end = {2, 2};
     
-    printf("Início: (%d, %d)\n", start.x, start.y);
-    printf("Fim: (%d, %d)\n", end.x, end.y);
+    LOG_INFO("Início: (%d, %d)", start.x, start.y);
+    LOG_INFO("Fim: (%d, %d)", end.x, end.y);
     
     // Algoritmo simples de busca em largura (BFS) para cavalo
     findKnightPath(start, end);
@@ -119,7 +117,7 @@ void demonstrateKnightPathfinding(ChessGame* game) {
 
 void findKnightPath(Position start, Position end) {
     // Implementação simplificada de busca de caminho
-    printf("Buscando caminho...\n");
+    LOG_INFO("Buscando caminho...");
     
     // Para demonstração, vamos usar uma abordagem simples
     int knightMoves[8][2] = {
@@ -131,8 +129,9 @@ void findKnightPath(Position start, Position end) {
     int steps = 0;
     int maxSteps = 10; // Limite para evitar loop infinito
     
-    printf("Caminho encontrado: ");
-    printf("(%d, %d) ", current.x, current.y);
+    // A linha do caminho é montada antes e registrada de uma vez
+    char path[256];
+    int length = snprintf(path, sizeof(path), "Caminho encontrado: (%d, %d)", current.x, current.y);
     
     while ((current.x != end.x || current.y != end.y) && steps < maxSteps) {
         // Encontrar o movimento que mais se aproxima do destino
@@ -156,33 +155,34 @@ void findKnightPath(Position start, Position end) {
             current.x += knightMoves[bestMove][0];
             current.y += knightMoves[bestMove][1];
             steps++;
-            printf("-> (%d, %d) ", current.x, current.y);
+            length += snprintf(path + length, sizeof(path) - length, " -> (%d, %d)", current.x, current.y);
         } else {
             break;
         }
     }
     
-    printf("\nTotal de passos: %d\n", steps);
+    LOG_INFO("%s", path);
+    LOG_INFO("Total de passos: %d", steps);
 }
 
 void drawAventureiroUI(ChessGame* game) {
     // Desenhar informações específicas do módulo Aventureiro
-    drawText(game, "MÓDULO AVENTUREIRO", 920, 50, COLOR_HIGHLIGHT);
-    drawText(game, "Cavalo: Movimento", 920, 80, COLOR_WHITE);
-    drawText(game, "em 'L'", 920, 100, COLOR_WHITE);
+    drawPanelText(game, "MÓDULO AVENTUREIRO", 50, COLOR_HIGHLIGHT);
+    drawPanelText(game, "Cavalo: Movimento", 80, COLOR_WHITE);
+    drawPanelText(game, "em 'L'", 100, COLOR_WHITE);
     
-    drawText(game, "Conceitos:", 920, 150, COLOR_LIGHT_BROWN);
-    drawText(game, "- Loops aninhados", 920, 170, COLOR_WHITE);
-    drawText(game, "- Validação de", 920, 190, COLOR_WHITE);
-    drawText(game, "  limites", 920, 210, COLOR_WHITE);
-    drawText(game, "- Arrays 2D", 920, 230, COLOR_WHITE);
+    drawPanelText(game, "Conceitos:", 150, COLOR_LIGHT_BROWN);
+    drawPanelText(game, "- Loops aninhados", 170, COLOR_WHITE);
+    drawPanelText(game, "- Validação de", 190, COLOR_WHITE);
+    drawPanelText(game, "  limites", 210, COLOR_WHITE);
+    drawPanelText(game, "- Arrays 2D", 230, COLOR_WHITE);
     
     // Mostrar movimentos do cavalo
-    drawText(game, "Movimentos L:", 920, 300, COLOR_LIGHT_BROWN);
-    drawText(game, "±2,±1 e ±1,±2", 920, 320, COLOR_WHITE);
+    drawPanelText(game, "Movimentos L:", 300, COLOR_LIGHT_BROWN);
+    drawPanelText(game, "±2,±1 e ±1,±2", 320, COLOR_WHITE);
     
     // Estatísticas
     char statsText[50];
     sprintf(statsText, "Máx. movimentos: 8");
-    drawText(game, statsText, 920, 400, COLOR_WHITE);
+    drawPanelText(game, statsText, 400, COLOR_WHITE);
 }
@@ -1,23 +1,38 @@
 #include "../chess_engine.h"
+#include <limits.h>
 
 // Módulo Mestre - Algoritmo Recursivo
 // Demonstra recursividade para encontrar o menor caminho do cavalo
+// e, no fim, o solucionador de mates por números de prova (df-pn)
+
+void initMestreBoard(ChessBoard* board);
+void demonstrateRecursiveKnight(ChessGame* game);
+void demonstrateOptimizedKnight(ChessGame* game);
+void demonstrateDfpnSolver(ChessGame* game);
+int findKnightMinMoves(Position current, Position target, bool visited[][BOARD_SIZE], int depth);
+int findKnightMinMovesOptimized(Position current, Position target, int memo[][BOARD_SIZE]);
+void compareAlgorithms(Position start, Position end);
+void comparePerformance(Position start, Position end);
 
 void runMestreModule(ChessGame* game) {
-    printf("=== MÓDULO MESTRE ===\n");
-    printf("Algoritmo recursivo para encontrar o menor caminho do cavalo\n");
-    printf("Conceitos: recursividade, backtracking, otimização\n\n");
+    LOG_INFO("=== MÓDULO MESTRE ===");
+    LOG_INFO("Algoritmo recursivo para encontrar o menor caminho do cavalo");
+    LOG_INFO("Conceitos: recursividade, backtracking, otimização");
     
     // Configurar tabuleiro para demonstração
     initMestreBoard(&game->board);
     
     // Demonstração do algoritmo recursivo
-    printf("--- ALGORITMO RECURSIVO DO CAVALO ---\n");
+    LOG_INFO("--- ALGORITMO RECURSIVO DO CAVALO ---");
     demonstrateRecursiveKnight(game);
     
     // Demonstração de otimização
-    printf("\n--- OTIMIZAÇÃO COM MEMOIZAÇÃO ---\n");
+    LOG_INFO("--- OTIMIZAÇÃO COM MEMOIZAÇÃO ---");
     demonstrateOptimizedKnight(game);
+
+    // Resolução de mates com números de prova
+    LOG_INFO("--- MATE FORÇADO COM DF-PN ---");
+    demonstrateDfpnSolver(game);
 }
 
 void initMestreBoard(ChessBoard* board) {
@@ -41,8 +56,8 @@ void demonstrateRecursiveKnight(ChessGame* game) {
     Position start = {0, 0};
     Position end = {7, 7};
     
-    printf("Encontrando menor caminho do cavalo de (%d, %d) para (%d, %d):\n", 
-           start.x, start.y, end.x, end.y);
+    LOG_INFO("Encontrando menor caminho do cavalo de (%d, %d) para (%d, %d):", 
+             start.x, start.y, end.x, end.y);
     
     // Matriz para rastrear posições visitadas
     bool visited[BOARD_SIZE][BOARD_SIZE] = {false};
@@ -50,10 +65,10 @@ void demonstrateRecursiveKnight(ChessGame* game) {
     // Encontrar caminho usando recursividade
     int minMoves = findKnightMinMoves(start, end, visited, 0);
     
-    printf("Menor número de movimentos: %d\n", minMoves);
+    LOG_INFO("Menor número de movimentos: %d", minMoves);
     
     // Demonstrar diferentes algoritmos
-    printf("\nComparando algoritmos:\n");
+    LOG_INFO("Comparando algoritmos:");
     compareAlgorithms(start, end);
 }
 
@@ -99,7 +114,7 @@ int findKnightMinMoves(Position current, Position target, bool visited[][BOARD_S
 }
 
 void demonstrateOptimizedKnight(ChessGame* game) {
-    printf("Implementação otimizada com memoização:\n");
+    LOG_INFO("Implementação otimizada com memoização:");
     
     Position start = {0, 0};
     Position end = {7, 7};
@@ -113,10 +128,10 @@ void demonstrateOptimizedKnight(ChessGame* game) {
     }
     
     int optimizedMoves = findKnightMinMovesOptimized(start, end, memo);
-    printf("Menor número de movimentos (otimizado): %d\n", optimizedMoves);
+    LOG_INFO("Menor número de movimentos (otimizado): %d", optimizedMoves);
     
     // Demonstrar diferença de performance
-    printf("\nComparação de performance:\n");
+    LOG_INFO("Comparação de performance:");
     comparePerformance(start, end);
 }
 
@@ -163,74 +178,168 @@ int findKnightMinMovesOptimized(Position current, Position target, int memo[][BO
 }
 
 void compareAlgorithms(Position start, Position end) {
-    printf("1. Algoritmo recursivo simples:\n");
-    printf("   - Complexidade: O(8^n) onde n é a profundidade\n");
-    printf("   - Vantagem: Código simples e fácil de entender\n");
-    printf("   - Desvantagem: Muito lento para distâncias grandes\n");
-    
-    printf("\n2. Algoritmo com memoização:\n");
-    printf("   - Complexidade: O(n²) onde n é o tamanho do tabuleiro\n");
-    printf("   - Vantagem: Muito mais rápido\n");
-    printf("   - Desvantagem: Usa mais memória\n");
-    
-    printf("\n3. Algoritmo BFS (Breadth-First Search):\n");
-    printf("   - Complexidade: O(n²)\n");
-    printf("   - Vantagem: Garante o caminho mais curto\n");
-    printf("   - Desvantagem: Mais complexo de implementar\n");
+    LOG_INFO("1. Algoritmo recursivo simples:");
+    LOG_INFO("   - Complexidade: O(8^n) onde n é a profundidade");
+    LOG_INFO("   - Vantagem: Código simples e fácil de entender");
+    LOG_INFO("   - Desvantagem: Muito lento para distâncias grandes");
+    
+    LOG_INFO("2. Algoritmo com memoização:");
+    LOG_INFO("   - Complexidade: O(n²) onde n é o tamanho do tabuleiro");
+    LOG_INFO("   - Vantagem: Muito mais rápido");
+    LOG_INFO("   - Desvantagem: Usa mais memória");
+    
+    LOG_INFO("3. Algoritmo BFS (Breadth-First Search):");
+    LOG_INFO("   - Complexidade: O(n²)");
+    LOG_INFO("   - Vantagem: Garante o caminho mais curto");
+    LOG_INFO("   - Desvantagem: Mais complexo de implementar");
 }
 
 void comparePerformance(Position start, Position end) {
-    printf("Testando performance com diferentes distâncias:\n");
+    LOG_INFO("Testando performance com diferentes distâncias:");
     
     Position testCases[4] = {
         {0, 0}, {3, 3}, {6, 6}, {7, 7}
     };
     
     for (int i = 0; i < 4; i++) {
-        printf("De (%d, %d) para (%d, %d): ", 
-               start.x, start.y, testCases[i].x, testCases[i].y);
-        
         // Simular cálculo (em um caso real, mediríamos o tempo)
         int distance = abs(testCases[i].x - start.x) + abs(testCases[i].y - start.y);
         int estimatedMoves = (distance + 2) / 3; // Estimativa simples
         
-        printf("%d movimentos estimados\n", estimatedMoves);
+        LOG_INFO("De (%d, %d) para (%d, %d): %d movimentos estimados",
+                 start.x, start.y, testCases[i].x, testCases[i].y, estimatedMoves);
     }
 }
 
 void demonstrateBacktracking(ChessGame* game) {
-    printf("\n--- DEMONSTRAÇÃO DE BACKTRACKING ---\n");
-    printf("O backtracking é essencial para:\n");
-    printf("1. Evitar loops infinitos\n");
-    printf("2. Encontrar todas as soluções possíveis\n");
-    printf("3. Otimizar o espaço de busca\n");
-    
-    printf("\nExemplo de backtracking no cavalo:\n");
-    printf("1. Marcar posição como visitada\n");
-    printf("2. Tentar todos os movimentos possíveis\n");
-    printf("3. Se não encontrar solução, desmarcar posição\n");
-    printf("4. Tentar próximo movimento\n");
+    LOG_INFO("--- DEMONSTRAÇÃO DE BACKTRACKING ---");
+    LOG_INFO("O backtracking é essencial para:");
+    LOG_INFO("1. Evitar loops infinitos");
+    LOG_INFO("2. Encontrar todas as soluções possíveis");
+    LOG_INFO("3. Otimizar o espaço de busca");
+    
+    LOG_INFO("Exemplo de backtracking no cavalo:");
+    LOG_INFO("1. Marcar posição como visitada");
+    LOG_INFO("2. Tentar todos os movimentos possíveis");
+    LOG_INFO("3. Se não encontrar solução, desmarcar posição");
+    LOG_INFO("4. Tentar próximo movimento");
+}
+
+// Resolve a posição do tabuleiro: mate do lado da vez em até maxMoves lances.
+// Roda na thread da interface, então a busca tem um limite de tempo; o resumo
+// fica em game->solverStatus para o painel lateral.
+bool solveMestrePosition(ChessGame* game, int maxMoves) {
+    DfpnResult result;
+    solveMateDfpn(&game->board, maxMoves, DFPN_DEFAULT_TABLE_MB, 0, DFPN_INTERACTIVE_BUDGET_MS, &result);
+
+    LOG_INFO("Mate em até %d lances: %s", maxMoves,
+             result.proven ? "provado" : (result.disproven ? "não existe" : "indefinido"));
+    if (result.proven) {
+        Move best = result.bestMove;
+        LOG_INFO("Primeiro lance: %c%d-%c%d",
+                 'a' + best.from.x, BOARD_SIZE - best.from.y,
+                 'a' + best.to.x, BOARD_SIZE - best.to.y);
+        snprintf(game->solverStatus, sizeof(game->solverStatus), "Mate: %c%d-%c%d",
+                 'a' + best.from.x, BOARD_SIZE - best.from.y,
+                 'a' + best.to.x, BOARD_SIZE - best.to.y);
+    } else if (result.disproven) {
+        snprintf(game->solverStatus, sizeof(game->solverStatus), "Sem mate em %d", maxMoves);
+    } else {
+        snprintf(game->solverStatus, sizeof(game->solverStatus), "Mate em %d: indefinido", maxMoves);
+    }
+
+    LOG_INFO("Nós: %lld em %.3f s (%.0f nós/s)", result.nodes, result.seconds, result.nodesPerSecond);
+    LOG_INFO("Tabela: pico de %ld de %ld entradas (%ld KB), %d coletas de lixo",
+             result.peakEntries, result.tableCapacity, result.peakBytes / 1024, result.gcRuns);
+    return result.proven;
+}
+
+// Versão do cavalo recursivo com limite de profundidade, contando chamadas.
+// Sem o limite a busca exaustiva não termina em tempo razoável.
+static int countKnightCalls(Position current, Position target, bool visited[][BOARD_SIZE],
+                            int depth, int limit, long long* calls) {
+    (*calls)++;
+    if (current.x == target.x && current.y == target.y) {
+        return depth;
+    }
+    if (depth == limit || visited[current.x][current.y]) {
+        return INT_MAX;
+    }
+
+    visited[current.x][current.y] = true;
+    int knightMoves[8][2] = {
+        {2, 1}, {2, -1}, {-2, 1}, {-2, -1},
+        {1, 2}, {1, -2}, {-1, 2}, {-1, -2}
+    };
+
+    int minMoves = INT_MAX;
+    for (int i = 0; i < 8 && minMoves == INT_MAX; i++) {
+        Position next = {current.x + knightMoves[i][0], current.y + knightMoves[i][1]};
+        if (isPositionValid(next)) {
+            minMoves = countKnightCalls(next, target, visited, depth + 1, limit, calls);
+        }
+    }
+
+    visited[current.x][current.y] = false;
+    return minMoves;
+}
+
+void demonstrateDfpnSolver(ChessGame* game) {
+    // Mate em 3: Rh7, Df4 e Tb3 contra Ra2 e peão b2
+    ChessBoard* board = &game->board;
+    clearBoard(board);
+    board->board[7][1].type = PIECE_KING;
+    board->board[5][4].type = PIECE_QUEEN;
+    board->board[1][5].type = PIECE_ROOK;
+    board->board[0][6].type = PIECE_KING;
+    board->board[0][6].color = COLOR_BLACK_PIECE;
+    board->board[1][6].type = PIECE_PAWN;
+    board->board[1][6].color = COLOR_BLACK_PIECE;
+
+    LOG_INFO("Brancas jogam e dão mate em 3:");
+    solveMestrePosition(game, 3);
+
+    // Custo por problema resolvido: a busca exaustiva de mate e o cavalo recursivo
+    long long mateNodes = 0;
+    Uint64 start = SDL_GetPerformanceCounter();
+    countMateSolutions(board, 3, NULL, &mateNodes);
+    double mateSeconds = (double)(SDL_GetPerformanceCounter() - start) / SDL_GetPerformanceFrequency();
+    LOG_INFO("Busca exaustiva de mate: %lld nós (%.0f nós/s)",
+             mateNodes, mateSeconds > 0 ? mateNodes / mateSeconds : 0.0);
+
+    Position from = {0, 0};
+    Position to = {7, 7};
+    bool visited[BOARD_SIZE][BOARD_SIZE] = {{false}};
+    long long knightCalls = 0;
+    int moves = INT_MAX;
+    start = SDL_GetPerformanceCounter();
+    for (int limit = 1; moves == INT_MAX; limit++) {    // Aprofundamento iterativo
+        moves = countKnightCalls(from, to, visited, 0, limit, &knightCalls);
+    }
+    double knightSeconds = (double)(SDL_GetPerformanceCounter() - start) / SDL_GetPerformanceFrequency();
+    LOG_INFO("Cavalo recursivo (%d lances, limite de profundidade): %lld chamadas (%.0f chamadas/s)",
+             moves, knightCalls, knightSeconds > 0 ? knightCalls / knightSeconds : 0.0);
 }
 
 void drawMestreUI(ChessGame* game) {
     // Desenhar informações específicas do módulo Mestre
-    drawText(game, "MÓDULO MESTRE", 920, 50, COLOR_HIGHLIGHT);
-    drawText(game, "Algoritmo", 920, 80, COLOR_WHITE);
-    drawText(game, "Recursivo", 920, 100, COLOR_WHITE);
+    drawPanelText(game, "MÓDULO MESTRE", 50, COLOR_HIGHLIGHT);
+    drawPanelText(game, "Algoritmo", 80, COLOR_WHITE);
+    drawPanelText(game, "Recursivo", 100, COLOR_WHITE);
     
-    drawText(game, "Conceitos:", 920, 150, COLOR_LIGHT_BROWN);
-    drawText(game, "- Recursividade", 920, 170, COLOR_WHITE);
-    drawText(game, "- Backtracking", 920, 190, COLOR_WHITE);
-    drawText(game, "- Memoização", 920, 210, COLOR_WHITE);
-    drawText(game, "- Otimização", 920, 230, COLOR_WHITE);
+    drawPanelText(game, "Conceitos:", 150, COLOR_LIGHT_BROWN);
+    drawPanelText(game, "- Recursividade", 170, COLOR_WHITE);
+    drawPanelText(game, "- Backtracking", 190, COLOR_WHITE);
+    drawPanelText(game, "- Memoização", 210, COLOR_WHITE);
+    drawPanelText(game, "- Otimização", 230, COLOR_WHITE);
     
     // Mostrar complexidade
-    drawText(game, "Complexidade:", 920, 300, COLOR_LIGHT_BROWN);
-    drawText(game, "Simples: O(8^n)", 920, 320, COLOR_WHITE);
-    drawText(game, "Otimizado: O(n²)", 920, 340, COLOR_WHITE);
+    drawPanelText(game, "Complexidade:", 300, COLOR_LIGHT_BROWN);
+    drawPanelText(game, "Simples: O(8^n)", 320, COLOR_WHITE);
+    drawPanelText(game, "Otimizado: O(n²)", 340, COLOR_WHITE);
     
     // Estatísticas avançadas
     char statsText[50];
     sprintf(statsText, "Posições testadas: %d", game->board.moveCount);
-    drawText(game, statsText, 920, 400, COLOR_WHITE);
+    drawPanelText(game, statsText, 400, COLOR_WHITE);
 }
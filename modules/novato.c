@@ -4,23 +4,23 @@
 // Demonstra estruturas de repetição simples (for, while, do-while)
 
 void runNovatoModule(ChessGame* game) {
-    printf("=== MÓDULO NOVATO ===\n");
-    printf("Aprenda os movimentos básicos da Torre, Bispo e Rainha\n");
-    printf("Usando estruturas de repetição: for, while, do-while\n\n");
+    LOG_INFO("=== MÓDULO NOVATO ===");
+    LOG_INFO("Aprenda os movimentos básicos da Torre, Bispo e Rainha");
+    LOG_INFO("Usando estruturas de repetição: for, while, do-while");
     
     // Configurar tabuleiro para demonstração
     initNovatoBoard(&game->board);
     
     // Demonstração da Torre
-    printf("--- MOVIMENTOS DA TORRE ---\n");
+    LOG_INFO("--- MOVIMENTOS DA TORRE ---");
     demonstrateRookMoves(game);
     
     // Demonstração do Bispo
-    printf("\n--- MOVIMENTOS DO BISPO ---\n");
+    LOG_INFO("--- MOVIMENTOS DO BISPO ---");
     demonstrateBishopMoves(game);
     
     // Demonstração da Rainha
-    printf("\n--- MOVIMENTOS DA RAINHA ---\n");
+    LOG_INFO("--- MOVIMENTOS DA RAINHA ---");
     demonstrateQueenMoves(game);
 }
 
@@ -52,107 +52,107 @@ void initNovatoBoard(ChessBoard* board) {
 
 void demonstrateRookMoves(ChessGame* game) {
     Position rookPos = {3, 3};
-    printf("Torre na posição (%d, %d):\n", rookPos.x, rookPos.y);
+    LOG_INFO("Torre na posição (%d, %d):", rookPos.x, rookPos.y);
     
     // Usando FOR para movimentos horizontais
-    printf("Movimentos horizontais (usando FOR):\n");
+    LOG_INFO("Movimentos horizontais (usando FOR):");
     for (int x = 0; x < BOARD_SIZE; x++) {
         if (x != rookPos.x) {
-            printf("  Torre pode mover para (%d, %d)\n", x, rookPos.y);
+            LOG_DEBUG("  Torre pode mover para (%d, %d)", x, rookPos.y);
         }
     }
     
     // Usando WHILE para movimentos verticais
-    printf("Movimentos verticais (usando WHILE):\n");
+    LOG_INFO("Movimentos verticais (usando WHILE):");
     int y = 0;
     while (y < BOARD_SIZE) {
         if (y != rookPos.y) {
-            printf("  Torre pode mover para (%d, %d)\n", rookPos.x, y);
+            LOG_DEBUG("  Torre pode mover para (%d, %d)", rookPos.x, y);
         }
         y++;
     }
     
     // Usando DO-WHILE para demonstrar conceito
-    printf("Demonstração DO-WHILE:\n");
+    LOG_INFO("Demonstração DO-WHILE:");
     int count = 0;
     do {
-        printf("  Iteração %d do DO-WHILE\n", count + 1);
+        LOG_DEBUG("  Iteração %d do DO-WHILE", count + 1);
         count++;
     } while (count < 3);
 }
 
 void demonstrateBishopMoves(ChessGame* game) {
     Position bishopPos = {4, 4};
-    printf("Bispo na posição (%d, %d):\n", bishopPos.x, bishopPos.y);
+    LOG_INFO("Bispo na posição (%d, %d):", bishopPos.x, bishopPos.y);
     
     // Usando FOR para diagonal principal
-    printf("Diagonal principal (usando FOR):\n");
+    LOG_INFO("Diagonal principal (usando FOR):");
     for (int i = 1; i < BOARD_SIZE; i++) {
         int newX = bishopPos.x + i;
         int newY = bishopPos.y + i;
         if (newX < BOARD_SIZE && newY < BOARD_SIZE) {
-            printf("  Bispo pode mover para (%d, %d)\n", newX, newY);
+            LOG_DEBUG("  Bispo pode mover para (%d, %d)", newX, newY);
         }
     }
     
     // Usando WHILE para diagonal secundária
-    printf("Diagonal secundária (usando WHILE):\n");
+    LOG_INFO("Diagonal secundária (usando WHILE):");
     int i = 1;
     while (bishopPos.x + i < BOARD_SIZE && bishopPos.y - i >= 0) {
-        printf("  Bispo pode mover para (%d, %d)\n", bishopPos.x + i, bishopPos.y - i);
+        LOG_DEBUG("  Bispo pode mover para (%d, %d)", bishopPos.x + i, bishopPos.y - i);
         i++;
     }
 }
 
 void demonstrateQueenMoves(ChessGame* game) {
     Position queenPos = {2, 2};
-    printf("Rainha na posição (%d, %d):\n", queenPos.x, queenPos.y);
-    printf("A Rainha combina movimentos da Torre e do Bispo!\n");
+    LOG_INFO("Rainha na posição (%d, %d):", queenPos.x, queenPos.y);
+    LOG_INFO("A Rainha combina movimentos da Torre e do Bispo!");
     
     // A rainha usa as mesmas funções da torre e bispo
-    printf("Movimentos da Rainha (combinação de Torre + Bispo):\n");
+    LOG_INFO("Movimentos da Rainha (combinação de Torre + Bispo):");
     
     // Movimentos horizontais e verticais (como a Torre)
-    printf("Movimentos lineares:\n");
+    LOG_INFO("Movimentos lineares:");
     for (int x = 0; x < BOARD_SIZE; x++) {
         if (x != queenPos.x) {
-            printf("  Rainha pode mover para (%d, %d)\n", x, queenPos.y);
+            LOG_DEBUG("  Rainha pode mover para (%d, %d)", x, queenPos.y);
         }
     }
     
     for (int y = 0; y < BOARD_SIZE; y++) {
         if (y != queenPos.y) {
-            printf("  Rainha pode mover para (%d, %d)\n", queenPos.x, y);
+            LOG_DEBUG("  Rainha pode mover para (%d, %d)", queenPos.x, y);
         }
     }
     
     // Movimentos diagonais (como o Bispo)
-    printf("Movimentos diagonais:\n");
+    LOG_INFO("Movimentos diagonais:");
     for (int i = 1; i < BOARD_SIZE; i++) {
         int newX = queenPos.x + i;
         int newY = queenPos.y + i;
         if (newX < BOARD_SIZE && newY < BOARD_SIZE) {
-            printf("  Rainha pode mover para (%d, %d)\n", newX, newY);
+            LOG_DEBUG("  Rainha pode mover para (%d, %d)", newX, newY);
         }
     }
 }
 
 void drawNovatoUI(ChessGame* game) {
     // Desenhar informações específicas do módulo Novato
-    drawText(game, "MÓDULO NOVATO", 920, 50, COLOR_HIGHLIGHT);
-    drawText(game, "Torre: Movimentos", 920, 80, COLOR_WHITE);
-    drawText(game, "horizontais e", 920, 100, COLOR_WHITE);
-    drawText(game, "verticais", 920, 120, COLOR_WHITE);
+    drawPanelText(game, "MÓDULO NOVATO", 50, COLOR_HIGHLIGHT);
+    drawPanelText(game, "Torre: Movimentos", 80, COLOR_WHITE);
+    drawPanelText(game, "horizontais e", 100, COLOR_WHITE);
+    drawPanelText(game, "verticais", 120, COLOR_WHITE);
     
-    drawText(game, "Bispo: Movimentos", 920, 200, COLOR_WHITE);
-    drawText(game, "diagonais", 920, 220, COLOR_WHITE);
+    drawPanelText(game, "Bispo: Movimentos", 200, COLOR_WHITE);
+    drawPanelText(game, "diagonais", 220, COLOR_WHITE);
     
-    drawText(game, "Rainha: Combina", 920, 300, COLOR_WHITE);
-    drawText(game, "Torre + Bispo", 920, 320, COLOR_WHITE);
+    drawPanelText(game, "Rainha: Combina", 300, COLOR_WHITE);
+    drawPanelText(game, "Torre + Bispo", 320, COLOR_WHITE);
     
     // Mostrar conceitos de programação
-    drawText(game, "Conceitos:", 920, 400, COLOR_LIGHT_BROWN);
-    drawText(game, "- FOR loops", 920, 420, COLOR_WHITE);
-    drawText(game, "- WHILE loops", 920, 440, COLOR_WHITE);
-    drawText(game, "- DO-WHILE loops", 920, 460, COLOR_WHITE);
+    drawPanelText(game, "Conceitos:", 400, COLOR_LIGHT_BROWN);
+    drawPanelText(game, "- FOR loops", 420, COLOR_WHITE);
+    drawPanelText(game, "- WHILE loops", 440, COLOR_WHITE);
+    drawPanelText(game, "- DO-WHILE loops", 460, COLOR_WHITE);
 }
@@ -11,26 +11,41 @@ int dentroDoTabuleiro(int x, int y) {
     return x >= 0 && x < TAMANHO_TABULEIRO && y >= 0 && y < TAMANHO_TABULEIRO;
 }
 
-void encontrarCaminhosCavalo(Posicao atual, Posicao destino, int passos, int* minPassos, SDL_Renderer* renderer) {
-    if (atual.x == destino.x && atual.y == destino.y) {
-        if (passos < *minPassos) *minPassos = passos;
-        return;
-    }
-    if (passos >= *minPassos) return;
+// Busca com limite de profundidade; as casas exploradas são apenas marcadas
+// e desenhadas depois, uma vez por quadro
+int encontrarCaminhosCavalo(Posicao atual, Posicao destino, int passos, int limite,
+                            int explorado[TAMANHO_TABULEIRO][TAMANHO_TABULEIRO]) {
+    if (atual.x == destino.x && atual.y == destino.y) return passos;
+    if (passos >= limite) return -1;
 
     int dx[] = {2, 2, -2, -2, 1, 1, -1, -1};
     int dy[] = {1, -1, 1, -1, 2, -2, 2, -2};
-    SDL_SetRenderDrawColor(renderer, 255, 255, 0, 255); // Amarelo para caminhos
     for (int i = 0; i < 8; i++) {
         int novoX = atual.x + dx[i];
         int novoY = atual.y + dy[i];
         if (dentroDoTabuleiro(novoX, novoY)) {
-            SDL_Rect rect = {novoX * TAMANHO_QUADRADO, novoY * TAMANHO_QUADRADO, TAMANHO_QUADRADO, TAMANHO_QUADRADO};
-            SDL_RenderDrawRect(renderer, &rect);
+            explorado[novoX][novoY] = 1;
             Posicao novaPos = {novoX, novoY};
-            encontrarCaminhosCavalo(novaPos, destino, passos + 1, minPassos, renderer);
+            int resultado = encontrarCaminhosCavalo(novaPos, destino, passos + 1, limite, explorado);
+            if (resultado >= 0) return resultado;
+        }
+    }
+    return -1;
+}
+
+void desenharExplorados(SDL_Renderer* renderer, int explorado[TAMANHO_TABULEIRO][TAMANHO_TABULEIRO]) {
+    SDL_Rect rects[TAMANHO_TABULEIRO * TAMANHO_TABULEIRO];
+    int total = 0;
+    for (int i = 0; i < TAMANHO_TABULEIRO; i++) {
+        for (int j = 0; j < TAMANHO_TABULEIRO; j++) {
+            if (explorado[i][j]) {
+                SDL_Rect rect = {i * TAMANHO_QUADRADO, j * TAMANHO_QUADRADO, TAMANHO_QUADRADO, TAMANHO_QUADRADO};
+                rects[total++] = rect;
+            }
         }
     }
+    SDL_SetRenderDrawColor(renderer, 255, 255, 0, 255); // Amarelo para caminhos
+    SDL_RenderDrawRects(renderer, rects, total);
 }
 
 void desenharTabuleiro(SDL_Renderer* renderer) {
@@ -55,10 +70,16 @@ int main() {
 
     Posicao inicio = {0, 0};
     Posicao destino = {7, 7};
-    int minPassos = 999999;
+    int explorado[TAMANHO_TABULEIRO][TAMANHO_TABULEIRO] = {{0}};
     int running = 1;
     SDL_Event event;
 
+    // A busca roda uma única vez, antes do laço de desenho (aprofundamento iterativo)
+    int minPassos = -1;
+    for (int limite = 0; minPassos < 0; limite++) {
+        minPassos = encontrarCaminhosCavalo(inicio, destino, 0, limite, explorado);
+    }
+
     while (running) {
         while (SDL_PollEvent(&event)) {
             if (event.type == SDL_QUIT) running = 0;
@@ -66,7 +87,7 @@ int main() {
         SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
         SDL_RenderClear(renderer);
         desenharTabuleiro(renderer);
-        encontrarCaminhosCavalo(inicio, destino, 0, &minPassos, renderer);
+        desenharExplorados(renderer, explorado);
         SDL_RenderPresent(renderer);
     }
 
@@ -0,0 +1,319 @@
+#ifdef __linux__
+#define _POSIX_C_SOURCE 200809L     // inet_pton e sigaction com -std=c99
+#endif
+
+#include "chess_engine.h"
+
+// Teste de carga do servidor de partidas (matecheck-netload)
+// Abre pares de conexões pelo loopback, cada par jogando uma partida contra
+// si mesmo com lances legais sorteados, e mede lances por segundo e a
+// latência de cada lance (do MOVE enviado até o OK MOVE do servidor). Quando
+// a partida acaba, ou chega ao limite de meios-lances, o par começa outra.
+// Uma thread só com epoll, como o servidor.
+
+#ifdef __linux__
+
+#include <errno.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/epoll.h>
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#define LOAD_EVENT_BATCH 256
+#define LOAD_LATENCY_BUCKETS 1000       // 0,1 ms cada; acima de 100 ms no último
+#define LOAD_MAX_REPORTS 10
+
+typedef struct LoadPair LoadPair;
+
+typedef struct {
+    int fd;
+    PieceColor color;
+    LoadPair* pair;
+    Uint64 sentAt;                  // Contador de desempenho do último MOVE
+    int inLength;
+    char in[NETWORK_BUFFER_SIZE];
+} LoadClient;
+
+struct LoadPair {
+    LoadClient players[2];
+    ChessBoard board;
+    int plies;
+    Uint64 rng;
+};
+
+typedef struct {
+    long long moves, games, errors, disconnects;
+    long long latency[LOAD_LATENCY_BUCKETS + 1];
+    double maxLatencyMs;
+    Uint64 frequency;
+    int maxPlies;
+    bool stopping;
+} LoadStats;
+
+static Uint64 nextRandom(Uint64* state) {
+    *state ^= *state << 13;
+    *state ^= *state >> 7;
+    *state ^= *state << 17;
+    return *state;
+}
+
+// Linhas curtas: o envio bloqueante nunca espera de fato no loopback
+static bool sendCommand(LoadClient* client, const char* text) {
+    char line[64];
+    int length = snprintf(line, sizeof(line), "%s\n", text);
+    return send(client->fd, line, (size_t)length, MSG_NOSIGNAL) == length;
+}
+
+static void playRandomMove(LoadPair* pair, LoadClient* client, LoadStats* stats) {
+    Move moves[MAX_LEGAL_MOVES];
+    int count = generateLegalMoves(&pair->board, moves);
+    if (count == 0 || pair->board.halfmoveClock >= 100) {
+        return;     // Mate, afogamento ou 50 lances: o END do servidor vem a seguir
+    }
+    if (pair->plies >= stats->maxPlies) {
+        sendCommand(client, "RESIGN");
+        return;
+    }
+
+    Move move = moves[nextRandom(&pair->rng) % (Uint64)count];
+    char text[UCI_MOVE_LENGTH];
+    char command[UCI_MOVE_LENGTH + 8];
+    moveToUCI(move, text);
+    MoveUndo undo;
+    applyMove(&pair->board, move, &undo);
+    pair->plies++;
+
+    snprintf(command, sizeof(command), "MOVE %s", text);
+    client->sentAt = SDL_GetPerformanceCounter();
+    sendCommand(client, command);
+}
+
+static void recordLatency(LoadStats* stats, LoadClient* client) {
+    double ms = (SDL_GetPerformanceCounter() - client->sentAt) * 1000.0 / stats->frequency;
+    int bucket = (int)(ms * 10.0);
+    if (bucket > LOAD_LATENCY_BUCKETS) bucket = LOAD_LATENCY_BUCKETS;
+    stats->latency[bucket]++;
+    if (ms > stats->maxLatencyMs) stats->maxLatencyMs = ms;
+    stats->moves++;
+}
+
+static void handleReply(LoadClient* client, char* line, LoadStats* stats) {
+    LoadPair* pair = client->pair;
+    LoadClient* opponent = &pair->players[!client->color];
+
+    if (strncmp(line, "GAME ", 5) == 0) {
+        if (client->color == COLOR_WHITE_PIECE) {
+            char join[32];
+            snprintf(join, sizeof(join), "JOIN %lu", strtoul(line + 5, NULL, 10));
+            sendCommand(opponent, join);
+        }
+    } else if (strcmp(line, "START") == 0) {
+        if (client->color == COLOR_WHITE_PIECE) {
+            loadFEN(&pair->board, STARTING_FEN);
+            pair->plies = 0;
+            playRandomMove(pair, client, stats);
+        }
+    } else if (strncmp(line, "OK MOVE ", 8) == 0) {
+        recordLatency(stats, client);
+    } else if (strncmp(line, "MOVE ", 5) == 0) {
+        playRandomMove(pair, client, stats);
+    } else if (strncmp(line, "END ", 4) == 0) {
+        if (client->color == COLOR_WHITE_PIECE) {
+            stats->games++;
+            if (!stats->stopping) sendCommand(client, "NEW");
+        }
+    } else if (strncmp(line, "ERR ", 4) == 0) {
+        if (stats->errors++ < LOAD_MAX_REPORTS) {
+            printf("Servidor respondeu: %s\n", line);
+        }
+    }
+}
+
+static bool readReplies(LoadClient* client, LoadStats* stats) {
+    ssize_t received = recv(client->fd, client->in + client->inLength,
+                            (size_t)(NETWORK_BUFFER_SIZE - client->inLength), 0);
+    if (received <= 0) {
+        return false;
+    }
+    client->inLength += (int)received;
+
+    char* start = client->in;
+    char* end = client->in + client->inLength;
+    char* newline;
+    while ((newline = memchr(start, '\n', (size_t)(end - start))) != NULL) {
+        *newline = '\0';
+        handleReply(client, start, stats);
+        start = newline + 1;
+    }
+    client->inLength = (int)(end - start);
+    memmove(client->in, start, (size_t)client->inLength);
+    return client->inLength < NETWORK_BUFFER_SIZE;
+}
+
+static int connectClient(const struct sockaddr_in* address) {
+    int fd = socket(AF_INET, SOCK_STREAM, 0);
+    if (fd < 0) return -1;
+    if (connect(fd, (const struct sockaddr*)address, sizeof(*address)) < 0) {
+        close(fd);
+        return -1;
+    }
+    int flag = 1;
+    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &flag, sizeof(flag));
+    return fd;
+}
+
+static double latencyPercentile(const LoadStats* stats, double fraction) {
+    long long wanted = (long long)(stats->moves * fraction);
+    long long seen = 0;
+    for (int i = 0; i <= LOAD_LATENCY_BUCKETS; i++) {
+        seen += stats->latency[i];
+        if (seen > wanted) return (i + 1) / 10.0;
+    }
+    return stats->maxLatencyMs;
+}
+
+static void printLoadUsage(void) {
+    printf("Uso: matecheck-netload [opções]\n");
+    printf("  -a ENDEREÇO   Servidor IPv4 (padrão: 127.0.0.1)\n");
+    printf("  -p PORTA      Porta (padrão: %d)\n", NETWORK_PORT);
+    printf("  -g PARTIDAS   Partidas simultâneas, duas conexões cada (padrão: 100)\n");
+    printf("  -m MEIOS      Meios-lances por partida antes de abandonar (padrão: 80)\n");
+    printf("  -d SEGUNDOS   Duração do teste (padrão: 10)\n");
+}
+
+int main(int argc, char* argv[]) {
+    const char* host = "127.0.0.1";
+    int port = NETWORK_PORT;
+    int pairCount = 100;
+    int seconds = 10;
+    static LoadStats stats;
+    stats.maxPlies = 80;
+
+    for (int i = 1; i < argc; i++) {
+        if (i + 1 < argc && strcmp(argv[i], "-a") == 0) {
+            host = argv[++i];
+        } else if (i + 1 < argc && strcmp(argv[i], "-p") == 0) {
+            port = atoi(argv[++i]);
+        } else if (i + 1 < argc && strcmp(argv[i], "-g") == 0) {
+            pairCount = atoi(argv[++i]);
+        } else if (i + 1 < argc && strcmp(argv[i], "-m") == 0) {
+            stats.maxPlies = atoi(argv[++i]);
+        } else if (i + 1 < argc && strcmp(argv[i], "-d") == 0) {
+            seconds = atoi(argv[++i]);
+        } else {
+            printLoadUsage();
+            return strcmp(argv[i], "-h") == 0 ? 0 : 1;
+        }
+    }
+
+    struct sockaddr_in address;
+    memset(&address, 0, sizeof(address));
+    address.sin_family = AF_INET;
+    address.sin_port = htons((Uint16)port);
+    if (pairCount < 1 || seconds < 1 || stats.maxPlies < 1 || inet_pton(AF_INET, host, &address.sin_addr) != 1) {
+        printLoadUsage();
+        return 1;
+    }
+
+    struct rlimit limit;
+    if (getrlimit(RLIMIT_NOFILE, &limit) == 0 && limit.rlim_cur < (rlim_t)pairCount * 2 + 16) {
+        limit.rlim_cur = MIN((rlim_t)pairCount * 2 + 16, limit.rlim_max);
+        setrlimit(RLIMIT_NOFILE, &limit);
+    }
+
+    LoadPair* pairs = (LoadPair*)calloc((size_t)pairCount, sizeof(LoadPair));
+    int epoll = epoll_create1(0);
+    if (!pairs || epoll < 0) {
+        printf("Erro ao iniciar o teste de carga\n");
+        return 1;
+    }
+
+    int connected = 0;
+    for (int i = 0; i < pairCount; i++) {
+        LoadPair* pair = &pairs[i];
+        pair->rng = 0x9E3779B97F4A7C15ULL * (Uint64)(i + 1);
+        for (int side = 0; side < 2; side++) {
+            LoadClient* client = &pair->players[side];
+            client->pair = pair;
+            client->color = (PieceColor)side;
+            client->fd = connectClient(&address);
+            if (client->fd < 0) {
+                printf("Erro ao conectar em %s:%d (%s) depois de %d conexões\n",
+                       host, port, strerror(errno), connected);
+                return 1;
+            }
+            struct epoll_event event;
+            event.events = EPOLLIN;
+            event.data.ptr = client;
+            epoll_ctl(epoll, EPOLL_CTL_ADD, client->fd, &event);
+            connected++;
+        }
+    }
+    printf("%d conexões abertas (%d partidas simultâneas)\n", connected, pairCount);
+    fflush(stdout);
+
+    stats.frequency = SDL_GetPerformanceFrequency();
+    Uint32 start = SDL_GetTicks();
+    for (int i = 0; i < pairCount; i++) {
+        sendCommand(&pairs[i].players[COLOR_WHITE_PIECE], "NEW");
+    }
+
+    struct epoll_event events[LOAD_EVENT_BATCH];
+    Uint32 lastReport = start;
+    long long lastMoves = 0;
+    int open = connected;
+    while (open > 0 && SDL_GetTicks() - start < (Uint32)seconds * 1000) {
+        int count = epoll_wait(epoll, events, LOAD_EVENT_BATCH, 100);
+        for (int i = 0; i < count; i++) {
+            LoadClient* client = (LoadClient*)events[i].data.ptr;
+            if (!readReplies(client, &stats)) {
+                epoll_ctl(epoll, EPOLL_CTL_DEL, client->fd, NULL);
+                close(client->fd);
+                client->fd = -1;
+                stats.disconnects++;
+                open--;
+            }
+        }
+
+        Uint32 now = SDL_GetTicks();
+        if (now - lastReport >= 1000) {
+            printf("%.0f lances/s, %lld partidas, %d conexões\n",
+                   (stats.moves - lastMoves) * 1000.0 / (now - lastReport), stats.games, open);
+            fflush(stdout);
+            lastReport = now;
+            lastMoves = stats.moves;
+        }
+    }
+    stats.stopping = true;
+
+    double elapsed = (SDL_GetTicks() - start) / 1000.0;
+    printf("%lld lances em %.1f s (%.0f lances/s), %lld partidas terminadas\n",
+           stats.moves, elapsed, stats.moves / elapsed, stats.games);
+    if (stats.moves > 0) {
+        printf("Latência: p50 %.1f ms, p95 %.1f ms, p99 %.1f ms, máx %.2f ms\n",
+               latencyPercentile(&stats, 0.50), latencyPercentile(&stats, 0.95),
+               latencyPercentile(&stats, 0.99), stats.maxLatencyMs);
+    }
+    printf("%lld erros, %lld conexões perdidas\n", stats.errors, stats.disconnects);
+
+    for (int i = 0; i < pairCount; i++) {
+        for (int side = 0; side < 2; side++) {
+            if (pairs[i].players[side].fd >= 0) close(pairs[i].players[side].fd);
+        }
+    }
+    close(epoll);
+    free(pairs);
+    return stats.errors > 0 || stats.disconnects > 0 ? 2 : 0;
+}
+
+#else
+
+int main(void) {
+    printf("matecheck-netload usa epoll e só está disponível no Linux\n");
+    return 1;
+}
+
+#endif
@@ -0,0 +1,678 @@
+#ifdef __linux__
+#define _POSIX_C_SOURCE 200809L     // sigaction e fcntl com -std=c99
+#endif
+
+#include "chess_engine.h"
+
+// Servidor de partidas em rede (matecheck-server)
+// Uma thread só, sockets não bloqueantes e epoll: cada conexão tem buffers
+// fixos de entrada e saída alocados no início, então o servidor não aloca
+// nada enquanto roda. O protocolo é de linhas de texto; todo lance recebido
+// passa por parseUCIMove (o mesmo gerador de lances do jogo) antes de chegar
+// ao adversário. Conexões sem mensagens por mais que o timeout são fechadas
+// por uma roda de timeouts: reagendar e expirar custam O(1) por conexão.
+// Um lance repassado também renova o prazo do adversário; fora disso o
+// cliente parado precisa mandar PING.
+//
+// Cliente -> servidor: NEW, JOIN <id>, MOVE <e2e4>, RESIGN, PING, QUIT
+// Servidor -> cliente: GAME <id> WHITE|BLACK, START, OK MOVE <lance>,
+//                      MOVE <lance>, END <resultado> <motivo>, PONG, ERR <motivo>
+
+#ifdef __linux__
+
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/epoll.h>
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#define NET_EVENT_BATCH 256
+#define NET_STATS_INTERVAL_MS 5000
+#define NET_LISTEN_BACKLOG 1024
+
+typedef struct NetGame NetGame;
+typedef struct Connection Connection;
+
+struct Connection {
+    int fd;                         // -1 = livre ou fechando
+    NetGame* game;
+    PieceColor color;
+    Uint32 expireTick;
+    Connection* timerPrev;          // Lista da posição expireTick da roda
+    Connection* timerNext;
+    Connection* nextPending;        // Lista de saída pendente
+    Connection* nextClosed;         // Lista de liberação no fim do lote
+    bool pending;
+    bool writing;                   // EPOLLOUT registrado
+    int inLength;
+    int outStart, outLength;
+    char in[NETWORK_BUFFER_SIZE];
+    char out[NETWORK_BUFFER_SIZE];
+};
+
+struct NetGame {
+    Uint32 id;                      // 0 = livre
+    ChessBoard board;
+    Connection* players[2];
+};
+
+typedef struct {
+    int listener;
+    int epoll;
+    Uint32 startTime;
+
+    Connection* connections;
+    int* freeConnections;           // Pilha de índices livres
+    int freeConnectionCount;
+    int maxConnections;
+    Connection* pendingWrites;      // Saída a enviar no fim do lote de eventos
+    Connection* pendingFree;        // Fechadas neste lote (podem ter eventos)
+
+    NetGame* games;
+    int* freeGames;
+    int freeGameCount;
+    Uint32 gameSequence;
+
+    Connection** wheel;             // Roda de timeouts: uma lista por tick
+    int wheelSlots;
+    Uint32 timeoutTicks;
+    Uint32 currentTick;
+
+    int activeConnections;
+    int activeGames;
+    long long accepted, refused, timeouts, moves, rejectedMoves, finishedGames;
+} NetServer;
+
+static volatile sig_atomic_t serverRunning = 1;
+
+static void handleSignal(int signal) {
+    (void)signal;
+    serverRunning = 0;
+}
+
+// ---- Roda de timeouts ----
+
+static void unlinkTimer(NetServer* server, Connection* connection) {
+    Connection** slot = &server->wheel[connection->expireTick % server->wheelSlots];
+    if (!connection->timerPrev && *slot != connection) {
+        return;     // Fora da roda
+    }
+    if (connection->timerPrev) {
+        connection->timerPrev->timerNext = connection->timerNext;
+    } else {
+        *slot = connection->timerNext;
+    }
+    if (connection->timerNext) {
+        connection->timerNext->timerPrev = connection->timerPrev;
+    }
+    connection->timerPrev = NULL;
+    connection->timerNext = NULL;
+}
+
+// Atividade na conexão: o prazo volta a ser timeout a partir de agora
+static void scheduleTimeout(NetServer* server, Connection* connection) {
+    Uint32 expireTick = server->currentTick + server->timeoutTicks;
+    if (connection->expireTick == expireTick && (connection->timerPrev ||
+        server->wheel[expireTick % server->wheelSlots] == connection)) {
+        return;
+    }
+    unlinkTimer(server, connection);
+    connection->expireTick = expireTick;
+    Connection** slot = &server->wheel[expireTick % server->wheelSlots];
+    connection->timerNext = *slot;
+    if (*slot) (*slot)->timerPrev = connection;
+    *slot = connection;
+}
+
+// ---- Saída ----
+
+static void queueWrite(NetServer* server, Connection* connection) {
+    if (!connection->pending) {
+        connection->pending = true;
+        connection->nextPending = server->pendingWrites;
+        server->pendingWrites = connection;
+    }
+}
+
+// Acrescenta uma linha ao buffer de saída; o envio fica para o fim do lote.
+// Sem espaço o cliente não está lendo e é desconectado em flushOutput.
+static void sendLine(NetServer* server, Connection* connection, const char* format, ...) {
+    if (connection->fd < 0 || connection->outLength < 0) return;
+    if (connection->outStart > 0) {
+        memmove(connection->out, connection->out + connection->outStart,
+                (size_t)(connection->outLength - connection->outStart));
+        connection->outLength -= connection->outStart;
+        connection->outStart = 0;
+    }
+
+    int room = NETWORK_BUFFER_SIZE - connection->outLength;
+    va_list args;
+    va_start(args, format);
+    int length = vsnprintf(connection->out + connection->outLength, (size_t)room, format, args);
+    va_end(args);
+    if (length < 0 || length + 1 >= room) {
+        connection->outLength = -1;     // Marca de estouro
+    } else {
+        connection->out[connection->outLength + length] = '\n';
+        connection->outLength += length + 1;
+    }
+    queueWrite(server, connection);
+}
+
+static void closeConnection(NetServer* server, Connection* connection, bool timedOut);
+
+static void setWriteInterest(NetServer* server, Connection* connection, bool writing) {
+    if (connection->writing == writing) return;
+    struct epoll_event event;
+    event.events = EPOLLIN | (writing ? EPOLLOUT : 0);
+    event.data.ptr = connection;
+    epoll_ctl(server->epoll, EPOLL_CTL_MOD, connection->fd, &event);
+    connection->writing = writing;
+}
+
+static void flushOutput(NetServer* server, Connection* connection) {
+    if (connection->fd < 0) return;
+    if (connection->outLength < 0) {
+        closeConnection(server, connection, false);
+        return;
+    }
+    while (connection->outStart < connection->outLength) {
+        ssize_t sent = send(connection->fd, connection->out + connection->outStart,
+                            (size_t)(connection->outLength - connection->outStart), MSG_NOSIGNAL);
+        if (sent < 0) {
+            if (errno == EINTR) continue;
+            if (errno == EAGAIN || errno == EWOULDBLOCK) {
+                setWriteInterest(server, connection, true);     // Termina quando o socket aceitar
+                return;
+            }
+            closeConnection(server, connection, false);
+            return;
+        }
+        connection->outStart += (int)sent;
+    }
+    connection->outStart = 0;
+    connection->outLength = 0;
+    setWriteInterest(server, connection, false);
+}
+
+static void flushPendingWrites(NetServer* server) {
+    while (server->pendingWrites) {
+        Connection* connection = server->pendingWrites;
+        server->pendingWrites = connection->nextPending;
+        connection->pending = false;
+        flushOutput(server, connection);
+    }
+}
+
+// ---- Partidas ----
+
+static NetGame* createGame(NetServer* server) {
+    if (server->freeGameCount == 0) return NULL;
+    int index = server->freeGames[--server->freeGameCount];
+    NetGame* game = &server->games[index];
+    // O id guarda o índice: JOIN encontra a partida sem busca
+    if (++server->gameSequence >= 0xFFFFFFFFu / (Uint32)server->maxConnections) {
+        server->gameSequence = 1;
+    }
+    game->id = server->gameSequence * (Uint32)server->maxConnections + (Uint32)index + 1;
+    loadFEN(&game->board, STARTING_FEN);
+    game->players[COLOR_WHITE_PIECE] = NULL;
+    game->players[COLOR_BLACK_PIECE] = NULL;
+    server->activeGames++;
+    return game;
+}
+
+static NetGame* findGame(NetServer* server, Uint32 id) {
+    if (id == 0) return NULL;
+    NetGame* game = &server->games[(id - 1) % (Uint32)server->maxConnections];
+    return game->id == id ? game : NULL;
+}
+
+static void endGame(NetServer* server, NetGame* game, const char* result, const char* reason) {
+    for (int side = 0; side < 2; side++) {
+        Connection* player = game->players[side];
+        if (player) {
+            sendLine(server, player, "END %s %s", result, reason);
+            player->game = NULL;
+        }
+    }
+    game->id = 0;
+    server->freeGames[server->freeGameCount++] = (int)(game - server->games);
+    server->activeGames--;
+    server->finishedGames++;
+}
+
+static const char* winFor(PieceColor color) {
+    return color == COLOR_WHITE_PIECE ? "1-0" : "0-1";
+}
+
+static void handleMove(NetServer* server, Connection* connection, const char* text) {
+    NetGame* game = connection->game;
+    if (!game || !game->players[COLOR_BLACK_PIECE]) {
+        sendLine(server, connection, "ERR nogame");
+        return;
+    }
+    if (game->board.currentPlayer != (int)connection->color) {
+        sendLine(server, connection, "ERR turn");
+        return;
+    }
+    Move move;
+    if (!parseUCIMove(&game->board, text, &move)) {
+        server->rejectedMoves++;
+        sendLine(server, connection, "ERR illegal %s", text);
+        return;
+    }
+
+    MoveUndo undo;
+    applyMove(&game->board, move, &undo);
+    server->moves++;
+    sendLine(server, connection, "OK MOVE %s", text);
+    sendLine(server, game->players[!connection->color], "MOVE %s", text);
+    // Quem espera o lance do adversário não está ocioso: o prazo dele
+    // recomeça junto com o de quem acabou de jogar
+    scheduleTimeout(server, game->players[!connection->color]);
+
+    switch (getGameStatus(&game->board)) {
+        case GAME_CHECKMATE:
+            endGame(server, game, winFor(connection->color), "checkmate");
+            break;
+        case GAME_STALEMATE:
+            endGame(server, game, "1/2-1/2", "stalemate");
+            break;
+        default:
+            if (game->board.halfmoveClock >= 100) {
+                endGame(server, game, "1/2-1/2", "fifty");
+            }
+            break;
+    }
+}
+
+static void handleLine(NetServer* server, Connection* connection, char* line) {
+    char* command = line + strspn(line, " \t");
+    char* argument = command + strcspn(command, " \t");
+    if (*argument) {
+        *argument++ = '\0';
+        argument += strspn(argument, " \t");
+    }
+
+    if (strcmp(command, "MOVE") == 0) {
+        handleMove(server, connection, argument);
+    } else if (strcmp(command, "PING") == 0) {
+        sendLine(server, connection, "PONG");
+    } else if (strcmp(command, "NEW") == 0) {
+        NetGame* game = connection->game ? NULL : createGame(server);
+        if (!game) {
+            sendLine(server, connection, connection->game ? "ERR busy" : "ERR full");
+            return;
+        }
+        game->players[COLOR_WHITE_PIECE] = connection;
+        connection->game = game;
+        connection->color = COLOR_WHITE_PIECE;
+        sendLine(server, connection, "GAME %u WHITE", (unsigned)game->id);
+    } else if (strcmp(command, "JOIN") == 0) {
+        NetGame* game = findGame(server, (Uint32)strtoul(argument, NULL, 10));
+        if (connection->game || !game || game->players[COLOR_BLACK_PIECE]) {
+            sendLine(server, connection, connection->game ? "ERR busy" : "ERR nogame");
+            return;
+        }
+        game->players[COLOR_BLACK_PIECE] = connection;
+        connection->game = game;
+        connection->color = COLOR_BLACK_PIECE;
+        sendLine(server, connection, "GAME %u BLACK", (unsigned)game->id);
+        sendLine(server, game->players[COLOR_WHITE_PIECE], "START");
+        sendLine(server, connection, "START");
+    } else if (strcmp(command, "RESIGN") == 0) {
+        if (connection->game) {
+            endGame(server, connection->game, winFor(!connection->color), "resign");
+        } else {
+            sendLine(server, connection, "ERR nogame");
+        }
+    } else if (strcmp(command, "QUIT") == 0) {
+        flushOutput(server, connection);
+        closeConnection(server, connection, false);
+    } else if (*command) {
+        sendLine(server, connection, "ERR unknown");
+    }
+}
+
+// ---- Conexões ----
+
+static void closeConnection(NetServer* server, Connection* connection, bool timedOut) {
+    if (connection->fd < 0) return;
+
+    NetGame* game = connection->game;
+    if (game) {
+        game->players[connection->color] = NULL;
+        connection->game = NULL;
+        if (game->players[!connection->color]) {
+            endGame(server, game, winFor(!connection->color), timedOut ? "timeout" : "abandon");
+        } else {
+            endGame(server, game, "*", "abandon");     // Ninguém entrou ainda
+        }
+    }
+
+    unlinkTimer(server, connection);
+    epoll_ctl(server->epoll, EPOLL_CTL_DEL, connection->fd, NULL);
+    close(connection->fd);
+    connection->fd = -1;
+    server->activeConnections--;
+    if (timedOut) server->timeouts++;
+
+    // A posição só volta para a pilha no fim do lote: ainda pode haver
+    // eventos dela no vetor do epoll_wait
+    connection->nextClosed = server->pendingFree;
+    server->pendingFree = connection;
+}
+
+static void releaseClosedConnections(NetServer* server) {
+    while (server->pendingFree) {
+        Connection* connection = server->pendingFree;
+        server->pendingFree = connection->nextClosed;
+        server->freeConnections[server->freeConnectionCount++] = (int)(connection - server->connections);
+    }
+}
+
+static void readInput(NetServer* server, Connection* connection) {
+    for (;;) {
+        int room = NETWORK_BUFFER_SIZE - connection->inLength;
+        if (room == 0) {
+            sendLine(server, connection, "ERR toolong");
+            flushOutput(server, connection);
+            closeConnection(server, connection, false);
+            return;
+        }
+        ssize_t received = recv(connection->fd, connection->in + connection->inLength, (size_t)room, 0);
+        if (received == 0) {
+            closeConnection(server, connection, false);
+            return;
+        }
+        if (received < 0) {
+            if (errno == EINTR) continue;
+            if (errno == EAGAIN || errno == EWOULDBLOCK) break;
+            closeConnection(server, connection, false);
+            return;
+        }
+        connection->inLength += (int)received;
+
+        // Linhas completas; o resto espera o próximo recv
+        char* start = connection->in;
+        char* end = connection->in + connection->inLength;
+        char* newline;
+        while ((newline = memchr(start, '\n', (size_t)(end - start))) != NULL) {
+            *newline = '\0';
+            if (newline > start && newline[-1] == '\r') newline[-1] = '\0';
+            handleLine(server, connection, start);
+            if (connection->fd < 0) return;
+            start = newline + 1;
+        }
+        connection->inLength = (int)(end - start);
+        memmove(connection->in, start, (size_t)connection->inLength);
+        if (received < room) break;     // Socket esvaziado
+    }
+    scheduleTimeout(server, connection);
+}
+
+static void acceptConnections(NetServer* server) {
+    for (;;) {
+        int fd = accept(server->listener, NULL, NULL);
+        if (fd < 0) {
+            if (errno == EINTR || errno == ECONNABORTED) continue;
+            if (errno != EAGAIN && errno != EWOULDBLOCK) {
+                printf("Aviso: accept falhou (%s)\n", strerror(errno));
+            }
+            return;
+        }
+        if (server->freeConnectionCount == 0) {
+            static const char full[] = "ERR full\n";
+            send(fd, full, sizeof(full) - 1, MSG_NOSIGNAL | MSG_DONTWAIT);
+            close(fd);
+            server->refused++;
+            continue;
+        }
+
+        int flag = 1;
+        fcntl(fd, F_SETFL, fcntl(fd, F_GETFL, 0) | O_NONBLOCK);
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &flag, sizeof(flag));
+
+        Connection* connection = &server->connections[server->freeConnections[--server->freeConnectionCount]];
+        memset(connection, 0, offsetof(Connection, in));
+        connection->fd = fd;
+        struct epoll_event event;
+        event.events = EPOLLIN;
+        event.data.ptr = connection;
+        if (epoll_ctl(server->epoll, EPOLL_CTL_ADD, fd, &event) < 0) {
+            close(fd);
+            connection->fd = -1;
+            server->freeConnections[server->freeConnectionCount++] = (int)(connection - server->connections);
+            continue;
+        }
+        scheduleTimeout(server, connection);
+        server->activeConnections++;
+        server->accepted++;
+    }
+}
+
+// Fecha as conexões das posições da roda pelas quais o relógio passou
+static void advanceTimers(NetServer* server) {
+    Uint32 now = (SDL_GetTicks() - server->startTime) / NETWORK_TICK_MS;
+    while (server->currentTick != now) {
+        server->currentTick++;
+        Connection* connection = server->wheel[server->currentTick % server->wheelSlots];
+        while (connection) {
+            Connection* next = connection->timerNext;
+            if (connection->expireTick == server->currentTick) {
+                sendLine(server, connection, "ERR timeout");
+                flushOutput(server, connection);
+                closeConnection(server, connection, true);
+            }
+            connection = next;
+        }
+    }
+}
+
+// ---- Início ----
+
+static bool openListener(NetServer* server, int port) {
+    server->listener = socket(AF_INET, SOCK_STREAM, 0);
+    if (server->listener < 0) return false;
+
+    int flag = 1;
+    setsockopt(server->listener, SOL_SOCKET, SO_REUSEADDR, &flag, sizeof(flag));
+    struct sockaddr_in address;
+    memset(&address, 0, sizeof(address));
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_ANY);
+    address.sin_port = htons((Uint16)port);
+    if (bind(server->listener, (struct sockaddr*)&address, sizeof(address)) < 0 ||
+        listen(server->listener, NET_LISTEN_BACKLOG) < 0) {
+        return false;
+    }
+    fcntl(server->listener, F_SETFL, fcntl(server->listener, F_GETFL, 0) | O_NONBLOCK);
+
+    struct epoll_event event;
+    event.events = EPOLLIN;
+    event.data.ptr = NULL;      // NULL = socket de escuta
+    return epoll_ctl(server->epoll, EPOLL_CTL_ADD, server->listener, &event) == 0;
+}
+
+// Cada conexão usa um descritor: sobe o limite do processo se preciso
+static int raiseDescriptorLimit(int connections) {
+    struct rlimit limit;
+    rlim_t wanted = (rlim_t)connections + 16;
+    if (getrlimit(RLIMIT_NOFILE, &limit) != 0) return connections;
+    if (limit.rlim_cur < wanted) {
+        limit.rlim_cur = wanted < limit.rlim_max ? wanted : limit.rlim_max;
+        setrlimit(RLIMIT_NOFILE, &limit);
+        getrlimit(RLIMIT_NOFILE, &limit);
+    }
+    if (limit.rlim_cur < wanted) {
+        printf("Aviso: limite de %lu descritores; máximo de conexões reduzido\n", (unsigned long)limit.rlim_cur);
+        return (int)limit.rlim_cur - 16;
+    }
+    return connections;
+}
+
+static bool createServer(NetServer* server, int port, int maxConnections, int timeoutMs) {
+    memset(server, 0, sizeof(*server));
+    server->maxConnections = maxConnections;
+    server->timeoutTicks = (Uint32)MAX(timeoutMs / NETWORK_TICK_MS, 1);
+    server->wheelSlots = (int)server->timeoutTicks + 1;     // O prazo nunca cai na posição atual
+
+    server->connections = (Connection*)calloc((size_t)maxConnections, sizeof(Connection));
+    server->freeConnections = (int*)calloc((size_t)maxConnections, sizeof(int));
+    server->games = (NetGame*)calloc((size_t)maxConnections, sizeof(NetGame));
+    server->freeGames = (int*)calloc((size_t)maxConnections, sizeof(int));
+    server->wheel = (Connection**)calloc((size_t)server->wheelSlots, sizeof(Connection*));
+    if (!server->connections || !server->freeConnections || !server->games || !server->freeGames || !server->wheel) {
+        printf("Erro: memória insuficiente para %d conexões\n", maxConnections);
+        return false;
+    }
+    for (int i = 0; i < maxConnections; i++) {
+        server->connections[i].fd = -1;
+        server->freeConnections[i] = maxConnections - 1 - i;
+        server->freeGames[i] = maxConnections - 1 - i;
+    }
+    server->freeConnectionCount = maxConnections;
+    server->freeGameCount = maxConnections;     // Uma partida por conexão no máximo
+
+    server->epoll = epoll_create1(0);
+    if (server->epoll < 0 || !openListener(server, port)) {
+        printf("Erro ao abrir a porta %d (%s)\n", port, strerror(errno));
+        return false;
+    }
+    server->startTime = SDL_GetTicks();
+    return true;
+}
+
+static void destroyServer(NetServer* server) {
+    for (int i = 0; i < server->maxConnections; i++) {
+        if (server->connections && server->connections[i].fd >= 0) {
+            closeConnection(server, &server->connections[i], false);
+        }
+    }
+    if (server->listener > 0) close(server->listener);
+    if (server->epoll > 0) close(server->epoll);
+    free(server->connections);
+    free(server->freeConnections);
+    free(server->games);
+    free(server->freeGames);
+    free(server->wheel);
+}
+
+static void printServerStats(NetServer* server, double seconds, long long moves) {
+    printf("%d conexões, %d partidas, %.0f lances/s | total: %lld lances, %lld ilegais, "
+           "%lld partidas, %lld timeouts, %lld recusadas\n",
+           server->activeConnections, server->activeGames, moves / seconds, server->moves,
+           server->rejectedMoves, server->finishedGames, server->timeouts, server->refused);
+    fflush(stdout);
+}
+
+static void printServerUsage(void) {
+    printf("Uso: matecheck-server [opções]\n");
+    printf("  -p PORTA      Porta TCP (padrão: %d)\n", NETWORK_PORT);
+    printf("  -c CONEXÕES   Máximo de conexões simultâneas (padrão: %d, até %d)\n",
+           NETWORK_MAX_CONNECTIONS, NETWORK_CONNECTION_LIMIT);
+    printf("  -t MS         Fecha conexões sem mensagens por MS (padrão: %d)\n", NETWORK_TIMEOUT);
+}
+
+int main(int argc, char* argv[]) {
+    int port = NETWORK_PORT;
+    int maxConnections = NETWORK_MAX_CONNECTIONS;
+    int timeoutMs = NETWORK_TIMEOUT;
+
+    for (int i = 1; i < argc; i++) {
+        if (i + 1 < argc && strcmp(argv[i], "-p") == 0) {
+            port = atoi(argv[++i]);
+        } else if (i + 1 < argc && strcmp(argv[i], "-c") == 0) {
+            maxConnections = atoi(argv[++i]);
+        } else if (i + 1 < argc && strcmp(argv[i], "-t") == 0) {
+            timeoutMs = atoi(argv[++i]);
+        } else {
+            printServerUsage();
+            return strcmp(argv[i], "-h") == 0 ? 0 : 1;
+        }
+    }
+    if (port <= 0 || port > 65535 || maxConnections < 1 || maxConnections > NETWORK_CONNECTION_LIMIT ||
+        timeoutMs < NETWORK_TICK_MS) {
+        printServerUsage();
+        return 1;
+    }
+    maxConnections = raiseDescriptorLimit(maxConnections);
+    if (maxConnections < 1) {
+        return 1;
+    }
+
+    static NetServer server;
+    if (!createServer(&server, port, maxConnections, timeoutMs)) {
+        destroyServer(&server);
+        return 1;
+    }
+
+    struct sigaction action;
+    memset(&action, 0, sizeof(action));
+    action.sa_handler = handleSignal;
+    sigaction(SIGINT, &action, NULL);
+    sigaction(SIGTERM, &action, NULL);
+    printf("Servidor na porta %d: até %d conexões, timeout de %d ms\n", port, maxConnections, timeoutMs);
+    fflush(stdout);
+
+    struct epoll_event events[NET_EVENT_BATCH];
+    Uint32 lastStats = SDL_GetTicks();
+    long long lastMoves = 0;
+
+    while (serverRunning) {
+        int count = epoll_wait(server.epoll, events, NET_EVENT_BATCH, NETWORK_TICK_MS);
+        if (count < 0 && errno != EINTR) {
+            printf("Erro no epoll_wait (%s)\n", strerror(errno));
+            break;
+        }
+
+        for (int i = 0; i < count; i++) {
+            Connection* connection = (Connection*)events[i].data.ptr;
+            if (!connection) {
+                acceptConnections(&server);
+                continue;
+            }
+            if (connection->fd < 0) continue;       // Fechada antes neste lote
+            if (events[i].events & (EPOLLIN | EPOLLERR | EPOLLHUP)) {
+                readInput(&server, connection);
+            }
+            if (connection->fd >= 0 && (events[i].events & EPOLLOUT)) {
+                flushOutput(&server, connection);
+            }
+        }
+
+        // Uma chamada send por conexão com tudo o que o lote gerou
+        flushPendingWrites(&server);
+        advanceTimers(&server);
+        flushPendingWrites(&server);
+        releaseClosedConnections(&server);
+
+        Uint32 now = SDL_GetTicks();
+        if (now - lastStats >= NET_STATS_INTERVAL_MS) {
+            printServerStats(&server, (now - lastStats) / 1000.0, server.moves - lastMoves);
+            lastStats = now;
+            lastMoves = server.moves;
+        }
+    }
+
+    printf("Encerrando: ");
+    printServerStats(&server, MAX((SDL_GetTicks() - server.startTime) / 1000.0, 0.001), server.moves);
+    destroyServer(&server);
+    return 0;
+}
+
+#else
+
+int main(void) {
+    printf("matecheck-server usa epoll e só está disponível no Linux\n");
+    return 1;
+}
+
+#endif
@@ -0,0 +1,551 @@
+#include "chess_engine.h"
+#include <ctype.h>
+#include <time.h>
+
+// Notação padrão para trocar partidas com outros programas
+// FEN para posições, SAN para lances e PGN para partidas inteiras. Casas:
+// coluna 'a' + x e fileira 8 - y (as brancas começam em y = 7).
+
+static const char pieceLetters[] = " PRNBQK";
+
+static PieceType letterToType(char letter) {
+    switch (toupper((unsigned char)letter)) {
+        case 'P': return PIECE_PAWN;
+        case 'R': return PIECE_ROOK;
+        case 'N': return PIECE_KNIGHT;
+        case 'B': return PIECE_BISHOP;
+        case 'Q': return PIECE_QUEEN;
+        case 'K': return PIECE_KING;
+        default: return PIECE_NONE;
+    }
+}
+
+static int homeRow(PieceColor color) {
+    return color == COLOR_WHITE_PIECE ? BOARD_SIZE - 1 : 0;
+}
+
+static bool canCastle(ChessBoard* board, PieceColor color, int rookX) {
+    int row = homeRow(color);
+    Piece* king = &board->board[4][row];
+    Piece* rook = &board->board[rookX][row];
+    return king->type == PIECE_KING && king->color == color && !king->hasMoved &&
+           rook->type == PIECE_ROOK && rook->color == color && !rook->hasMoved;
+}
+
+// === FEN ===
+
+void boardToFEN(ChessBoard* board, char fen[FEN_MAX_LENGTH]) {
+    char* out = fen;
+
+    for (int y = 0; y < BOARD_SIZE; y++) {
+        int empty = 0;
+        for (int x = 0; x < BOARD_SIZE; x++) {
+            Piece* piece = &board->board[x][y];
+            if (piece->type == PIECE_NONE) {
+                empty++;
+                continue;
+            }
+            if (empty) {
+                *out++ = (char)('0' + empty);
+                empty = 0;
+            }
+            char letter = pieceLetters[piece->type];
+            *out++ = piece->color == COLOR_WHITE_PIECE ? letter : (char)tolower((unsigned char)letter);
+        }
+        if (empty) {
+            *out++ = (char)('0' + empty);
+        }
+        if (y < BOARD_SIZE - 1) {
+            *out++ = '/';
+        }
+    }
+
+    *out++ = ' ';
+    *out++ = board->currentPlayer == COLOR_WHITE_PIECE ? 'w' : 'b';
+    *out++ = ' ';
+
+    char* rights = out;
+    if (canCastle(board, COLOR_WHITE_PIECE, BOARD_SIZE - 1)) *out++ = 'K';
+    if (canCastle(board, COLOR_WHITE_PIECE, 0)) *out++ = 'Q';
+    if (canCastle(board, COLOR_BLACK_PIECE, BOARD_SIZE - 1)) *out++ = 'k';
+    if (canCastle(board, COLOR_BLACK_PIECE, 0)) *out++ = 'q';
+    if (out == rights) *out++ = '-';
+    *out++ = ' ';
+
+    if (isPositionValid(board->enPassant) && (board->enPassant.y == 2 || board->enPassant.y == 5)) {
+        *out++ = (char)('a' + board->enPassant.x);
+        *out++ = (char)('0' + BOARD_SIZE - board->enPassant.y);
+    } else {
+        *out++ = '-';
+    }
+
+    snprintf(out, (size_t)(FEN_MAX_LENGTH - (out - fen)), " %d %d",
+             board->halfmoveClock, board->moveCount / 2 + 1);
+}
+
+// Lê uma posição FEN; o tabuleiro só é alterado se o texto for válido
+bool loadFEN(ChessBoard* board, const char* fen) {
+    ChessBoard result;
+    clearBoard(&result);
+
+    const char* c = fen;
+    while (*c == ' ') c++;
+
+    // Peças, da fileira 8 (y = 0) para a 1
+    for (int y = 0; y < BOARD_SIZE; y++) {
+        int x = 0;
+        while (x < BOARD_SIZE) {
+            if (*c >= '1' && *c <= '8') {
+                x += *c - '0';
+            } else {
+                PieceType type = letterToType(*c);
+                if (type == PIECE_NONE) return false;
+
+                Piece* piece = &result.board[x][y];
+                piece->type = type;
+                piece->color = isupper((unsigned char)*c) ? COLOR_WHITE_PIECE : COLOR_BLACK_PIECE;
+                // Só peões na fileira inicial e peças com direito a roque
+                // (ajustadas abaixo) contam como não movidas
+                piece->hasMoved = !(type == PIECE_PAWN &&
+                                    y == (piece->color == COLOR_WHITE_PIECE ? 6 : 1));
+                x++;
+            }
+            c++;
+        }
+        if (x != BOARD_SIZE) return false;
+        if (y < BOARD_SIZE - 1 && *c++ != '/') return false;
+    }
+
+    if (*c++ != ' ') return false;
+    if (*c != 'w' && *c != 'b') return false;
+    result.currentPlayer = *c++ == 'w' ? COLOR_WHITE_PIECE : COLOR_BLACK_PIECE;
+
+    // Roque: rei e torre envolvidos voltam a "não movidos"
+    if (*c++ != ' ') return false;
+    if (*c == '-') {
+        c++;
+    } else {
+        while (*c && *c != ' ') {
+            PieceColor color = isupper((unsigned char)*c) ? COLOR_WHITE_PIECE : COLOR_BLACK_PIECE;
+            char side = (char)toupper((unsigned char)*c);
+            if (side != 'K' && side != 'Q') return false;
+
+            int row = homeRow(color);
+            Piece* king = &result.board[4][row];
+            Piece* rook = &result.board[side == 'K' ? BOARD_SIZE - 1 : 0][row];
+            if (king->type != PIECE_KING || king->color != color ||
+                rook->type != PIECE_ROOK || rook->color != color) {
+                return false;
+            }
+            king->hasMoved = false;
+            rook->hasMoved = false;
+            c++;
+        }
+    }
+
+    // En passant (só nas fileiras 3 e 6)
+    if (*c++ != ' ') return false;
+    if (*c == '-') {
+        c++;
+    } else {
+        if (c[0] < 'a' || c[0] > 'h' || (c[1] != '3' && c[1] != '6')) return false;
+        result.enPassant.x = c[0] - 'a';
+        result.enPassant.y = BOARD_SIZE - (c[1] - '0');
+        c += 2;
+    }
+
+    // Contadores são opcionais (muitas posições vêm sem eles)
+    int halfmove = 0, fullmove = 1;
+    if (*c == ' ') {
+        char* next;
+        halfmove = (int)strtol(c, &next, 10);
+        if (next != c) {
+            c = next;
+            fullmove = (int)strtol(c, &next, 10);
+            if (next == c) fullmove = 1;
+        }
+    }
+    if (halfmove < 0 || fullmove < 1) return false;
+
+    result.halfmoveClock = halfmove;
+    result.moveCount = (fullmove - 1) * 2 + result.currentPlayer;
+    *board = result;
+    return true;
+}
+
+// === SAN ===
+
+static bool isLegalFor(ChessBoard* board, Move move, PieceColor color) {
+    MoveUndo undo;
+    applyMove(board, move, &undo);
+    bool legal = !isKingInCheck(board, color);
+    undoMove(board, &undo);
+    return legal;
+}
+
+static bool reaches(ChessBoard* board, Position from, Position to) {
+    Position targets[64];
+    int count = 0;
+    getPossibleMoves(board, from, targets, &count);
+    for (int i = 0; i < count; i++) {
+        if (targets[i].x == to.x && targets[i].y == to.y) return true;
+    }
+    return false;
+}
+
+// Escreve o lance em SAN (ex.: "Nbd2", "exd6", "O-O", "e8=Q+"). A cor vem
+// da peça na origem, então vale também para lances fora da vez na interface.
+void moveToSAN(ChessBoard* board, Move move, char san[SAN_MAX_LENGTH]) {
+    Piece piece = board->board[move.from.x][move.from.y];
+    Piece* target = &board->board[move.to.x][move.to.y];
+    bool capture = target->type != PIECE_NONE ||
+                   (piece.type == PIECE_PAWN && move.from.x != move.to.x);
+    char* out = san;
+
+    if (piece.type == PIECE_KING && abs(move.to.x - move.from.x) == 2) {
+        strcpy(out, move.to.x > move.from.x ? "O-O" : "O-O-O");
+        out += strlen(out);
+    } else {
+        if (piece.type == PIECE_PAWN) {
+            if (capture) *out++ = (char)('a' + move.from.x);
+        } else {
+            *out++ = pieceLetters[piece.type];
+
+            // Outra peça igual que também chega ao destino: coluna, fileira ou ambas
+            bool ambiguous = false, sameFile = false, sameRank = false;
+            for (int x = 0; x < BOARD_SIZE; x++) {
+                for (int y = 0; y < BOARD_SIZE; y++) {
+                    Piece* other = &board->board[x][y];
+                    if ((x == move.from.x && y == move.from.y) || other->type != piece.type ||
+                        other->color != piece.color) {
+                        continue;
+                    }
+                    Position from = {x, y};
+                    Move alternative = {from, move.to, PIECE_NONE};
+                    if (reaches(board, from, move.to) && isLegalFor(board, alternative, piece.color)) {
+                        ambiguous = true;
+                        sameFile = sameFile || x == move.from.x;
+                        sameRank = sameRank || y == move.from.y;
+                    }
+                }
+            }
+            if (ambiguous && (!sameFile || sameRank)) *out++ = (char)('a' + move.from.x);
+            if (ambiguous && sameFile) *out++ = (char)('0' + BOARD_SIZE - move.from.y);
+        }
+        if (capture) *out++ = 'x';
+        *out++ = (char)('a' + move.to.x);
+        *out++ = (char)('0' + BOARD_SIZE - move.to.y);
+        if (move.promotion != PIECE_NONE) {
+            *out++ = '=';
+            *out++ = pieceLetters[move.promotion];
+        }
+    }
+
+    // Xeque e mate na posição depois do lance
+    MoveUndo undo;
+    applyMove(board, move, &undo);
+    if (isKingInCheck(board, !piece.color)) {
+        bool mate = board->currentPlayer != (int)piece.color && getGameStatus(board) == GAME_CHECKMATE;
+        *out++ = mate ? '#' : '+';
+    }
+    undoMove(board, &undo);
+    *out = '\0';
+}
+
+// Converte um lance SAN do jogador da vez; falha se for ilegal ou ambíguo
+bool parseSAN(ChessBoard* board, const char* san, Move* move) {
+    PieceColor side = board->currentPlayer;
+    char text[SAN_MAX_LENGTH];
+    size_t length = 0;
+
+    // Sem sufixos de xeque e anotações (+, #, !, ?)
+    while (san[length] && length < SAN_MAX_LENGTH - 1) {
+        text[length] = san[length];
+        length++;
+    }
+    if (san[length]) return false;
+    while (length > 0 && strchr("+#!?", text[length - 1])) length--;
+    text[length] = '\0';
+
+    int row = homeRow(side);
+    if (strcmp(text, "O-O") == 0 || strcmp(text, "0-0") == 0 ||
+        strcmp(text, "O-O-O") == 0 || strcmp(text, "0-0-0") == 0) {
+        Move castle = {{4, row}, {length == 3 ? 6 : 2, row}, PIECE_NONE};
+        Piece* king = &board->board[4][row];
+        if (king->type != PIECE_KING || king->color != side ||
+            !reaches(board, castle.from, castle.to) || !isLegalFor(board, castle, side)) {
+            return false;
+        }
+        *move = castle;
+        return true;
+    }
+
+    // Promoção: "e8=Q" ou "e8Q"
+    PieceType promotion = PIECE_NONE;
+    if (length >= 2 && letterToType(text[length - 1]) != PIECE_NONE && isupper((unsigned char)text[length - 1])) {
+        promotion = letterToType(text[length - 1]);
+        length -= text[length - 2] == '=' ? 2 : 1;
+    }
+    if (length < 2) return false;
+
+    Position to = {text[length - 2] - 'a', BOARD_SIZE - (text[length - 1] - '0')};
+    if (!isPositionValid(to)) return false;
+
+    // Peça, desambiguação (coluna e/ou fileira) e captura
+    size_t start = 0;
+    PieceType type = PIECE_PAWN;
+    if (isupper((unsigned char)text[0])) {
+        type = letterToType(text[0]);
+        if (type == PIECE_NONE || type == PIECE_PAWN) return false;
+        start = 1;
+    }
+    int fromX = -1, fromY = -1;
+    for (size_t i = start; i < length - 2; i++) {
+        if (text[i] >= 'a' && text[i] <= 'h') fromX = text[i] - 'a';
+        else if (text[i] >= '1' && text[i] <= '8') fromY = BOARD_SIZE - (text[i] - '0');
+        else if (text[i] != 'x' && text[i] != ':') return false;
+    }
+    if (type == PIECE_PAWN && fromX < 0) {
+        fromX = to.x;   // Sem coluna de origem o peão só avança
+    }
+
+    bool lastRank = type == PIECE_PAWN && (to.y == 0 || to.y == BOARD_SIZE - 1);
+    if (lastRank != (promotion != PIECE_NONE) || promotion == PIECE_KING) return false;
+
+    int found = 0;
+    for (int x = 0; x < BOARD_SIZE; x++) {
+        if (fromX >= 0 && x != fromX) continue;
+        for (int y = 0; y < BOARD_SIZE; y++) {
+            if (fromY >= 0 && y != fromY) continue;
+            Piece* piece = &board->board[x][y];
+            if (piece->type != type || piece->color != side) continue;
+
+            Position from = {x, y};
+            Move candidate = {from, to, promotion};
+            if (reaches(board, from, to) && isLegalFor(board, candidate, side)) {
+                *move = candidate;
+                found++;
+            }
+        }
+    }
+    return found == 1;
+}
+
+// === Notação longa (UCI e protocolo de rede) ===
+
+// "e2e4", "e7e8q"; o roque é o rei andando duas casas ("e1g1")
+void moveToUCI(Move move, char text[UCI_MOVE_LENGTH]) {
+    text[0] = (char)('a' + move.from.x);
+    text[1] = (char)('0' + BOARD_SIZE - move.from.y);
+    text[2] = (char)('a' + move.to.x);
+    text[3] = (char)('0' + BOARD_SIZE - move.to.y);
+    text[4] = move.promotion != PIECE_NONE ? (char)tolower((unsigned char)pieceLetters[move.promotion]) : '\0';
+    text[5] = '\0';
+}
+
+// Converte um lance em notação longa do jogador da vez; falha se for ilegal
+bool parseUCIMove(ChessBoard* board, const char* text, Move* move) {
+    Move legal[MAX_LEGAL_MOVES];
+    int count = generateLegalMoves(board, legal);
+    for (int i = 0; i < count; i++) {
+        char candidate[UCI_MOVE_LENGTH];
+        moveToUCI(legal[i], candidate);
+        if (strcmp(candidate, text) == 0) {
+            *move = legal[i];
+            return true;
+        }
+    }
+    return false;
+}
+
+// === PGN ===
+
+static const char* skipSpace(const char* c, const char* end) {
+    while (c < end && isspace((unsigned char)*c)) c++;
+    return c;
+}
+
+// Lê os pares de tags; a posição inicial vem da tag FEN (ou é a padrão).
+// Retorna o início dos lances, ou NULL se a tag FEN for inválida.
+const char* parsePGNHeader(const char* text, const char* end, ChessBoard* start) {
+    const char* c = skipSpace(text, end);
+    loadFEN(start, STARTING_FEN);
+
+    while (c < end && *c == '[') {
+        char name[16], value[FEN_MAX_LENGTH];
+        size_t nameLength = 0, valueLength = 0;
+
+        c++;
+        while (c < end && !isspace((unsigned char)*c) && *c != ']' && *c != '"') {
+            if (nameLength < sizeof(name) - 1) name[nameLength++] = *c;
+            c++;
+        }
+        name[nameLength] = '\0';
+
+        c = skipSpace(c, end);
+        if (c < end && *c == '"') {
+            for (c++; c < end && *c != '"'; c++) {
+                if (*c == '\\' && c + 1 < end) c++;
+                if (valueLength < sizeof(value) - 1) value[valueLength++] = *c;
+            }
+        }
+        value[valueLength] = '\0';
+        while (c < end && *c != ']' && *c != '\n') c++;
+        if (c < end && *c == ']') c++;
+
+        if (strcmp(name, "FEN") == 0 && !loadFEN(start, value)) {
+            return NULL;
+        }
+        c = skipSpace(c, end);
+    }
+    return c;
+}
+
+// Próximo lance SAN do texto, pulando números, comentários, variantes e
+// NAGs. Retorna false no resultado, no início da próxima partida ou no fim.
+bool nextPGNMove(const char** cursor, const char* end, char san[SAN_MAX_LENGTH]) {
+    const char* c = *cursor;
+
+    while (c < end) {
+        if (isspace((unsigned char)*c) || *c == '.') {
+            c++;
+        } else if (*c == '{') {
+            while (c < end && *c != '}') c++;
+            if (c < end) c++;
+        } else if (*c == ';' || *c == '%') {
+            while (c < end && *c != '\n') c++;
+        } else if (*c == '(') {
+            // Variantes podem ter comentários e outras variantes dentro
+            int depth = 0;
+            do {
+                if (*c == '(') depth++;
+                else if (*c == ')') depth--;
+                else if (*c == '{') {
+                    while (c < end && *c != '}') c++;
+                    if (c == end) break;
+                }
+                c++;
+            } while (c < end && depth > 0);
+        } else if (*c == '$') {
+            for (c++; c < end && isdigit((unsigned char)*c); c++) {}
+        } else if (*c == '[' || *c == '*') {
+            break;
+        } else {
+            const char* token = c;
+            while (c < end && !isspace((unsigned char)*c) && !strchr("{}();[", *c)) c++;
+            size_t length = (size_t)(c - token);
+
+            if (isdigit((unsigned char)*token) && token[0] != '0') {
+                // Número do lance ("12." ou "12...") ou resultado ("1-0", "1/2-1/2")
+                const char* digits = token;
+                while (digits < c && isdigit((unsigned char)*digits)) digits++;
+                if (digits < c && *digits != '.') break;
+                c = digits;
+                continue;
+            }
+            if (length >= 3 && (strncmp(token, "0-1", 3) == 0) && (length == 3 || token[3] != '-')) {
+                break;
+            }
+
+            if (length >= SAN_MAX_LENGTH) length = SAN_MAX_LENGTH - 1;
+            memcpy(san, token, length);
+            san[length] = '\0';
+            *cursor = c;
+            return true;
+        }
+    }
+
+    // Fim da partida: consumir o resultado para a próxima leitura começar nas tags
+    while (c < end && *c != '[' ) c++;
+    *cursor = c;
+    return false;
+}
+
+// Lê uma partida PGN (a primeira do texto); retorna o número de lances ou -1
+int readPGN(const char* text, size_t length, ChessBoard* start, Move moves[], int maxMoves) {
+    const char* end = text + length;
+    const char* cursor = parsePGNHeader(text, end, start);
+    if (!cursor) return -1;
+
+    ChessBoard board = *start;
+    char san[SAN_MAX_LENGTH];
+    int count = 0;
+
+    while (nextPGNMove(&cursor, end, san)) {
+        Move move;
+        if (count >= maxMoves || !parseSAN(&board, san, &move)) {
+            return -1;
+        }
+        MoveUndo undo;
+        applyMove(&board, move, &undo);
+        moves[count++] = move;
+    }
+    return count;
+}
+
+static const char* gameResult(ChessBoard* board) {
+    switch (getGameStatus(board)) {
+        case GAME_CHECKMATE: return board->currentPlayer == COLOR_WHITE_PIECE ? "0-1" : "1-0";
+        case GAME_STALEMATE: return "1/2-1/2";
+        default: return "*";
+    }
+}
+
+// Grava a partida com as sete tags obrigatórias (+ SetUp/FEN fora da posição
+// padrão) e os lances quebrados em linhas de até 80 colunas
+bool writePGN(FILE* file, ChessBoard* start, const Move moves[], int count, const char* white) {
+    ChessBoard board = *start;
+    char fen[FEN_MAX_LENGTH];
+    char date[16] = "????.??.??";
+    time_t now = time(NULL);
+    struct tm* local = localtime(&now);
+    if (local) strftime(date, sizeof(date), "%Y.%m.%d", local);
+
+    // O resultado depende da posição final
+    for (int i = 0; i < count; i++) {
+        MoveUndo undo;
+        applyMove(&board, moves[i], &undo);
+    }
+    const char* result = gameResult(&board);
+    board = *start;
+
+    fprintf(file, "[Event \"MateCheck\"]\n[Site \"?\"]\n[Date \"%s\"]\n[Round \"-\"]\n", date);
+    fprintf(file, "[White \"%s\"]\n[Black \"MateCheck\"]\n[Result \"%s\"]\n", white, result);
+    boardToFEN(&board, fen);
+    if (strcmp(fen, STARTING_FEN) != 0) {
+        fprintf(file, "[SetUp \"1\"]\n[FEN \"%s\"]\n", fen);
+    }
+    fputc('\n', file);
+
+    int column = 0;
+    for (int i = 0; i < count; i++) {
+        char token[SAN_MAX_LENGTH + 16];
+        char san[SAN_MAX_LENGTH];
+        int number = board.moveCount / 2 + 1;
+
+        moveToSAN(&board, moves[i], san);
+        if (board.currentPlayer == COLOR_WHITE_PIECE) {
+            snprintf(token, sizeof(token), "%d. %s", number, san);
+        } else if (i == 0) {
+            snprintf(token, sizeof(token), "%d... %s", number, san);
+        } else {
+            snprintf(token, sizeof(token), "%s", san);
+        }
+
+        int length = (int)strlen(token);
+        if (column > 0 && column + 1 + length > 79) {
+            fputc('\n', file);
+            column = 0;
+        } else if (column > 0) {
+            fputc(' ', file);
+            column++;
+        }
+        fputs(token, file);
+        column += length;
+
+        MoveUndo undo;
+        applyMove(&board, moves[i], &undo);
+    }
+    fprintf(file, "%s%s\n\n", column > 0 ? " " : "", result);
+    return !ferror(file);
+}
@@ -0,0 +1,40 @@
+#include "chess_engine.h"
+
+// Empacotador de assets (make assets-pack)
+// Junta os arquivos dados num único pacote indexado que o jogo mapeia na
+// memória ao iniciar (ver assetpack.c).
+
+static void printPackUsage(void) {
+    printf("Uso: matecheck-pack [-o pacote] arquivo...\n");
+    printf("  -o pacote   Arquivo de saída (padrão: %s)\n", ASSET_PACK_PATH);
+    printf("  Os nomes no pacote são os caminhos dados (ex.: assets/fonts/arial.ttf)\n");
+}
+
+int main(int argc, char* argv[]) {
+    const char* outputPath = ASSET_PACK_PATH;
+    const char** files = (const char**)calloc((size_t)argc, sizeof(char*));
+    int count = 0;
+
+    if (!files) {
+        return 1;
+    }
+
+    for (int i = 1; i < argc; i++) {
+        if (i + 1 < argc && strcmp(argv[i], "-o") == 0) {
+            outputPath = argv[++i];
+        } else if (argv[i][0] == '-') {
+            printPackUsage();
+            free(files);
+            return strcmp(argv[i], "-h") == 0 ? 0 : 1;
+        } else {
+            files[count++] = argv[i];
+        }
+    }
+
+    bool ok = writeAssetPack(outputPath, files, count);
+    if (ok) {
+        printf("Pacote criado: %s (%d assets)\n", outputPath, count);
+    }
+    free(files);
+    return ok ? 0 : 1;
+}
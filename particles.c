@@ -0,0 +1,204 @@
+#include "chess_engine.h"
+
+#if defined(__SSE__) || defined(_M_X64)
+#include <xmmintrin.h>
+#define PARTICLES_USE_SSE 1
+#endif
+
+// Sistema de partículas para capturas, promoções e mate (FEATURE_PARTICLES)
+// As partículas ficam num pool de capacidade fixa organizado como estrutura
+// de arrays: cada campo é um vetor contíguo de floats, e a atualização
+// processa 4 partículas por instrução com SSE (com versão escalar para o
+// resto e para outras arquiteturas). O desenho é uma única chamada de
+// SDL_RenderGeometry com dois triângulos por partícula.
+
+#if FEATURE_PARTICLES
+
+#define PARTICLE_GRAVITY 400.0f     // pixels/s²
+#define PARTICLE_SIZE 4.0f
+
+typedef struct {
+    float x[PARTICLE_CAPACITY];
+    float y[PARTICLE_CAPACITY];
+    float vx[PARTICLE_CAPACITY];
+    float vy[PARTICLE_CAPACITY];
+    float life[PARTICLE_CAPACITY];      // Segundos restantes
+    float maxLife[PARTICLE_CAPACITY];
+    SDL_Color color[PARTICLE_CAPACITY];
+    int count;
+} ParticlePool;
+
+static ParticlePool pool;
+static SDL_Vertex vertices[PARTICLE_CAPACITY * 4];
+static int indices[PARTICLE_CAPACITY * 6];
+static bool indicesReady = false;
+static Uint64 lastUpdate = 0;
+static Uint32 particleSeed = 0x9E3779B9u;
+
+static float randomUnit(void) {
+    // xorshift32, suficiente para efeitos visuais
+    particleSeed ^= particleSeed << 13;
+    particleSeed ^= particleSeed >> 17;
+    particleSeed ^= particleSeed << 5;
+    return (particleSeed >> 8) * (1.0f / 16777216.0f);
+}
+
+// Emite uma explosão centrada em (x, y), em pixels da janela
+void emitParticles(float x, float y, SDL_Color color, int amount, float speed) {
+    if (pool.count == 0) {
+        lastUpdate = SDL_GetPerformanceCounter();
+    }
+
+    for (int i = 0; i < amount && pool.count < PARTICLE_CAPACITY; i++) {
+        int p = pool.count++;
+        float angle = randomUnit() * 6.2831853f;
+        float velocity = speed * (0.3f + 0.7f * randomUnit());
+
+        pool.x[p] = x;
+        pool.y[p] = y;
+        pool.vx[p] = cosf(angle) * velocity;
+        pool.vy[p] = sinf(angle) * velocity - speed * 0.5f;
+        pool.maxLife[p] = 0.6f + 0.6f * randomUnit();
+        pool.life[p] = pool.maxLife[p];
+        pool.color[p] = color;
+    }
+}
+
+// Integração de todas as partículas vivas (sem desvios no laço principal)
+static void integrateParticles(float dt) {
+    int i = 0;
+
+#ifdef PARTICLES_USE_SSE
+    __m128 step = _mm_set1_ps(dt);
+    __m128 gravity = _mm_set1_ps(PARTICLE_GRAVITY * dt);
+    for (; i + 4 <= pool.count; i += 4) {
+        __m128 vx = _mm_loadu_ps(&pool.vx[i]);
+        __m128 vy = _mm_add_ps(_mm_loadu_ps(&pool.vy[i]), gravity);
+        _mm_storeu_ps(&pool.x[i], _mm_add_ps(_mm_loadu_ps(&pool.x[i]), _mm_mul_ps(vx, step)));
+        _mm_storeu_ps(&pool.y[i], _mm_add_ps(_mm_loadu_ps(&pool.y[i]), _mm_mul_ps(vy, step)));
+        _mm_storeu_ps(&pool.vy[i], vy);
+        _mm_storeu_ps(&pool.life[i], _mm_sub_ps(_mm_loadu_ps(&pool.life[i]), step));
+    }
+#endif
+
+    // Versão escalar (resto do SSE ou arquiteturas sem SSE)
+    for (; i < pool.count; i++) {
+        pool.vy[i] += PARTICLE_GRAVITY * dt;
+        pool.x[i] += pool.vx[i] * dt;
+        pool.y[i] += pool.vy[i] * dt;
+        pool.life[i] -= dt;
+    }
+}
+
+// Remove as partículas mortas trocando-as pela última do pool
+static void compactParticles(void) {
+    int i = 0;
+    while (i < pool.count) {
+        if (pool.life[i] > 0.0f) {
+            i++;
+            continue;
+        }
+        int last = --pool.count;
+        pool.x[i] = pool.x[last];
+        pool.y[i] = pool.y[last];
+        pool.vx[i] = pool.vx[last];
+        pool.vy[i] = pool.vy[last];
+        pool.life[i] = pool.life[last];
+        pool.maxLife[i] = pool.maxLife[last];
+        pool.color[i] = pool.color[last];
+    }
+}
+
+// Avança a simulação pelo tempo real decorrido; retorna true se havia
+// partículas (quando a última some, a tela ainda precisa ser limpa)
+bool updateParticles(void) {
+    if (pool.count == 0) {
+        return false;
+    }
+
+    Uint64 now = SDL_GetPerformanceCounter();
+    float dt = (float)((double)(now - lastUpdate) / (double)SDL_GetPerformanceFrequency());
+    lastUpdate = now;
+    if (dt > 0.1f) dt = 0.1f;     // Evita saltos depois de uma pausa longa
+
+    integrateParticles(dt);
+    compactParticles();
+    return true;
+}
+
+void drawParticles(ChessGame* game) {
+    if (pool.count == 0) return;
+
+    if (!indicesReady) {
+        for (int p = 0; p < PARTICLE_CAPACITY; p++) {
+            int* quad = &indices[p * 6];
+            quad[0] = p * 4;
+            quad[1] = p * 4 + 1;
+            quad[2] = p * 4 + 2;
+            quad[3] = p * 4 + 2;
+            quad[4] = p * 4 + 3;
+            quad[5] = p * 4;
+        }
+        indicesReady = true;
+    }
+
+    const float half = PARTICLE_SIZE * game->layout.scale / 2.0f;
+    for (int p = 0; p < pool.count; p++) {
+        SDL_Color color = pool.color[p];
+        color.a = (Uint8)(255.0f * pool.life[p] / pool.maxLife[p]);
+
+        SDL_Vertex* quad = &vertices[p * 4];
+        quad[0].position.x = pool.x[p] - half;
+        quad[0].position.y = pool.y[p] - half;
+        quad[1].position.x = pool.x[p] + half;
+        quad[1].position.y = pool.y[p] - half;
+        quad[2].position.x = pool.x[p] + half;
+        quad[2].position.y = pool.y[p] + half;
+        quad[3].position.x = pool.x[p] - half;
+        quad[3].position.y = pool.y[p] + half;
+        for (int v = 0; v < 4; v++) {
+            quad[v].color = color;
+            quad[v].tex_coord.x = 0.0f;
+            quad[v].tex_coord.y = 0.0f;
+        }
+    }
+
+    SDL_SetRenderDrawBlendMode(game->renderer, SDL_BLENDMODE_BLEND);
+    SDL_RenderGeometry(game->renderer, NULL, vertices, pool.count * 4, indices, pool.count * 6);
+    SDL_SetRenderDrawBlendMode(game->renderer, SDL_BLENDMODE_NONE);
+}
+
+int getParticleCount(void) {
+    return pool.count;
+}
+
+void clearParticles(void) {
+    pool.count = 0;
+}
+
+#else
+
+void emitParticles(float x, float y, SDL_Color color, int amount, float speed) {
+    (void)x;
+    (void)y;
+    (void)color;
+    (void)amount;
+    (void)speed;
+}
+
+bool updateParticles(void) {
+    return false;
+}
+
+void drawParticles(ChessGame* game) {
+    (void)game;
+}
+
+int getParticleCount(void) {
+    return 0;
+}
+
+void clearParticles(void) {
+}
+
+#endif
@@ -0,0 +1,278 @@
+#include "chess_engine.h"
+
+// Busca de caminhos com A* sobre o tabuleiro real
+// Os vizinhos de cada casa vêm dos geradores de movimento das peças,
+// então peças no caminho bloqueiam a rota de verdade.
+
+#define PATH_SQUARES (BOARD_SIZE * BOARD_SIZE)
+#define PATH_UNREACHABLE 1000
+
+// Distâncias do cavalo em tabuleiro vazio (heurística exata sem bloqueios)
+static unsigned char knightDistance[PATH_SQUARES][PATH_SQUARES];
+static bool knightDistanceReady = false;
+
+// Conjunto aberto: heap binário de capacidade fixa (cada casa entra no máximo uma vez)
+typedef struct {
+    int nodes[PATH_SQUARES];
+    int heapIndex[PATH_SQUARES];   // -1 = fora do heap
+    int size;
+} PathHeap;
+
+static PathHeap openSet;
+static int costSoFar[PATH_SQUARES];
+static int estimate[PATH_SQUARES];
+static int cameFrom[PATH_SQUARES];
+static bool closed[PATH_SQUARES];
+
+static int squareIndex(Position pos) {
+    return pos.y * BOARD_SIZE + pos.x;
+}
+
+static Position indexToPosition(int index) {
+    Position pos = {index % BOARD_SIZE, index / BOARD_SIZE};
+    return pos;
+}
+
+static void initKnightDistances(void) {
+    int knightMoves[8][2] = {
+        {2, 1}, {2, -1}, {-2, 1}, {-2, -1},
+        {1, 2}, {1, -2}, {-1, 2}, {-1, -2}
+    };
+
+    // Uma BFS por casa de origem: 64 * 64 entradas, calculadas uma única vez
+    for (int start = 0; start < PATH_SQUARES; start++) {
+        int queue[PATH_SQUARES];
+        int head = 0, tail = 0;
+
+        memset(knightDistance[start], 0xFF, PATH_SQUARES);
+        knightDistance[start][start] = 0;
+        queue[tail++] = start;
+
+        while (head < tail) {
+            int current = queue[head++];
+            Position pos = indexToPosition(current);
+
+            for (int i = 0; i < 8; i++) {
+                Position next = {pos.x + knightMoves[i][0], pos.y + knightMoves[i][1]};
+                if (!isPositionValid(next)) continue;
+
+                int nextIndex = squareIndex(next);
+                if (knightDistance[start][nextIndex] == 0xFF) {
+                    knightDistance[start][nextIndex] = knightDistance[start][current] + 1;
+                    queue[tail++] = nextIndex;
+                }
+            }
+        }
+    }
+
+    knightDistanceReady = true;
+}
+
+// Heurística admissível por tipo de peça (nunca superestima, pois bloqueios só aumentam o custo)
+static int pathHeuristic(PieceType type, PieceColor color, Position from, Position to) {
+    int dx = abs(to.x - from.x);
+    int dy = abs(to.y - from.y);
+
+    switch (type) {
+        case PIECE_KNIGHT:
+            return knightDistance[squareIndex(from)][squareIndex(to)];
+        case PIECE_KING:
+            return dx > dy ? dx : dy;   // Distância de Chebyshev
+        case PIECE_ROOK:
+            return (dx != 0) + (dy != 0);
+        case PIECE_BISHOP:
+            if (dx == 0 && dy == 0) return 0;
+            if (dx == dy) return 1;
+            if ((dx + dy) % 2 == 0) return 2;
+            return PATH_UNREACHABLE;    // Casa de outra cor
+        case PIECE_QUEEN:
+            if (dx == 0 && dy == 0) return 0;
+            if (dx == 0 || dy == 0 || dx == dy) return 1;
+            return 2;
+        case PIECE_PAWN: {
+            int direction = (color == COLOR_WHITE_PIECE) ? -1 : 1;
+            int forward = (to.y - from.y) * direction;
+            if (forward < 0 || dx > forward) return PATH_UNREACHABLE;
+            int steps = (forward + 1) / 2;  // Avanço duplo conta como um lance
+            return dx > steps ? dx : steps;
+        }
+        default:
+            return PATH_UNREACHABLE;
+    }
+}
+
+static bool heapLess(int a, int b) {
+    if (estimate[a] != estimate[b]) return estimate[a] < estimate[b];
+    return costSoFar[a] > costSoFar[b];  // Empate: preferir o nó mais profundo
+}
+
+static void heapSwap(int i, int j) {
+    int tmp = openSet.nodes[i];
+    openSet.nodes[i] = openSet.nodes[j];
+    openSet.nodes[j] = tmp;
+    openSet.heapIndex[openSet.nodes[i]] = i;
+    openSet.heapIndex[openSet.nodes[j]] = j;
+}
+
+static void heapSiftUp(int i) {
+    while (i > 0) {
+        int parent = (i - 1) / 2;
+        if (!heapLess(openSet.nodes[i], openSet.nodes[parent])) break;
+        heapSwap(i, parent);
+        i = parent;
+    }
+}
+
+static void heapSiftDown(int i) {
+    for (;;) {
+        int left = 2 * i + 1;
+        int right = left + 1;
+        int best = i;
+
+        if (left < openSet.size && heapLess(openSet.nodes[left], openSet.nodes[best])) best = left;
+        if (right < openSet.size && heapLess(openSet.nodes[right], openSet.nodes[best])) best = right;
+        if (best == i) break;
+
+        heapSwap(i, best);
+        i = best;
+    }
+}
+
+// Insere ou diminui a prioridade de um nó já presente
+static void heapPush(int node) {
+    if (openSet.heapIndex[node] >= 0) {
+        heapSiftUp(openSet.heapIndex[node]);
+        return;
+    }
+    openSet.nodes[openSet.size] = node;
+    openSet.heapIndex[node] = openSet.size;
+    heapSiftUp(openSet.size++);
+}
+
+static int heapPop(void) {
+    int top = openSet.nodes[0];
+    openSet.heapIndex[top] = -1;
+    openSet.size--;
+
+    if (openSet.size > 0) {
+        openSet.nodes[0] = openSet.nodes[openSet.size];
+        openSet.heapIndex[openSet.nodes[0]] = 0;
+        heapSiftDown(0);
+    }
+    return top;
+}
+
+// Encontra o menor caminho de uma peça do tipo informado entre duas casas.
+// Retorna o número de lances (ou -1 se não houver rota) e preenche path[] com
+// as casas visitadas, incluindo origem e destino. Usa buffers estáticos: não é reentrante.
+int findPiecePath(ChessBoard* board, PieceType type, PieceColor color,
+                  Position from, Position to, Position path[], int maxPath) {
+    if (!isPositionValid(from) || !isPositionValid(to) || type == PIECE_NONE) {
+        return -1;
+    }
+
+    if (!knightDistanceReady) {
+        initKnightDistances();
+    }
+
+    if (pathHeuristic(type, color, from, to) >= PATH_UNREACHABLE) {
+        return -1;
+    }
+
+    int start = squareIndex(from);
+    int goal = squareIndex(to);
+
+    for (int i = 0; i < PATH_SQUARES; i++) {
+        costSoFar[i] = PATH_UNREACHABLE;
+        cameFrom[i] = -1;
+        closed[i] = false;
+        openSet.heapIndex[i] = -1;
+    }
+    openSet.size = 0;
+
+    // A peça sai da origem durante a busca para não bloquear a si mesma
+    Piece original = board->board[from.x][from.y];
+    board->board[from.x][from.y].type = PIECE_NONE;
+
+    costSoFar[start] = 0;
+    estimate[start] = pathHeuristic(type, color, from, to);
+    heapPush(start);
+
+    bool found = false;
+    while (openSet.size > 0) {
+        int current = heapPop();
+        if (current == goal) {
+            found = true;
+            break;
+        }
+        closed[current] = true;
+
+        // Colocar a peça temporariamente na casa e usar o gerador existente
+        Position pos = indexToPosition(current);
+        Piece* square = &board->board[pos.x][pos.y];
+        square->type = type;
+        square->color = color;
+        square->hasMoved = (current != start) || original.hasMoved;
+
+        Position moves[64];
+        int moveCount = 0;
+        getPossibleMoves(board, pos, moves, &moveCount);
+
+        square->type = PIECE_NONE;
+        square->color = COLOR_WHITE_PIECE;
+        square->hasMoved = false;
+
+        for (int i = 0; i < moveCount; i++) {
+            int next = squareIndex(moves[i]);
+            if (closed[next]) continue;
+
+            // Capturas só são permitidas no destino final
+            if (next != goal && board->board[moves[i].x][moves[i].y].type != PIECE_NONE) continue;
+
+            int cost = costSoFar[current] + 1;
+            if (cost < costSoFar[next]) {
+                costSoFar[next] = cost;
+                cameFrom[next] = current;
+                estimate[next] = cost + pathHeuristic(type, color, moves[i], to);
+                heapPush(next);
+            }
+        }
+    }
+
+    board->board[from.x][from.y] = original;
+
+    if (!found) {
+        return -1;
+    }
+
+    int length = costSoFar[goal];
+    if (path && maxPath > 0) {
+        int node = goal;
+        for (int i = length; i >= 0; i--) {
+            if (i < maxPath) {
+                path[i] = indexToPosition(node);
+            }
+            node = cameFrom[node];
+        }
+    }
+
+    return length;
+}
+
+// Atualiza a rota mostrada na interface para a peça selecionada
+void updateSelectedRoute(ChessGame* game, Position target) {
+    game->routeLength = -1;
+
+    if (!game->board.isSelected) {
+        return;
+    }
+
+    Piece* piece = getPieceAt(&game->board, game->board.selected);
+    if (!piece || piece->type == PIECE_NONE) {
+        return;
+    }
+
+    game->routeLength = findPiecePath(&game->board, piece->type, piece->color,
+                                      game->board.selected, target,
+                                      game->route, BOARD_SIZE * BOARD_SIZE);
+}
@@ -0,0 +1,99 @@
+#include "chess_engine.h"
+
+// Contagem de lances (matecheck-perft)
+// Percorre a árvore de lances legais até a profundidade pedida e compara as
+// folhas com os valores conhecidos das posições de referência: qualquer erro
+// no gerador (roque, en passant, promoção, cravadas) muda a contagem. Sem
+// argumentos roda as posições de referência e sai com erro se alguma divergir;
+// com "FEN profundidade" mostra a contagem por lance da raiz (divide).
+
+typedef struct {
+    const char* name;
+    const char* fen;
+    int depth;
+    long long expected;
+} PerftCase;
+
+static const PerftCase perftCases[] = {
+    {"inicial",   STARTING_FEN, 4, 197281},
+    {"kiwipete",  "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1", 3, 97862},
+    {"posição 3", "8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1", 5, 674624},
+    {"posição 4", "r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1", 3, 9467},
+    {"posição 5", "rnbq1k1r/pp1Pbppp/2p5/8/2B5/8/PPP1NnPP/RNBQK2R w KQ - 1 8", 3, 62379},
+};
+
+static long long perft(ChessBoard* board, int depth) {
+    Move moves[MAX_LEGAL_MOVES];
+    int count = generateLegalMoves(board, moves);
+    if (depth <= 1) {
+        return depth == 1 ? count : 1;
+    }
+
+    long long nodes = 0;
+    for (int i = 0; i < count; i++) {
+        MoveUndo undo;
+        applyMove(board, moves[i], &undo);
+        nodes += perft(board, depth - 1);
+        undoMove(board, &undo);
+    }
+    return nodes;
+}
+
+static int runDivide(const char* fen, int depth) {
+    ChessBoard board;
+    if (!loadFEN(&board, fen) || depth < 1) {
+        printf("FEN ou profundidade inválida\n");
+        return 1;
+    }
+
+    Move moves[MAX_LEGAL_MOVES];
+    int count = generateLegalMoves(&board, moves);
+    long long total = 0;
+    for (int i = 0; i < count; i++) {
+        char text[UCI_MOVE_LENGTH];
+        MoveUndo undo;
+        applyMove(&board, moves[i], &undo);
+        long long nodes = perft(&board, depth - 1);
+        undoMove(&board, &undo);
+        moveToUCI(moves[i], text);
+        printf("%s: %lld\n", text, nodes);
+        total += nodes;
+    }
+    printf("\nTotal: %lld\n", total);
+    return 0;
+}
+
+int main(int argc, char* argv[]) {
+    if (argc == 3) {
+        return runDivide(argv[1], atoi(argv[2]));
+    }
+    if (argc != 1) {
+        printf("Uso: matecheck-perft [\"FEN\" profundidade]\n");
+        return 1;
+    }
+
+    int failures = 0;
+    for (size_t i = 0; i < sizeof(perftCases) / sizeof(perftCases[0]); i++) {
+        const PerftCase* test = &perftCases[i];
+        ChessBoard board;
+        if (!loadFEN(&board, test->fen)) {
+            printf("FEN inválida: %s\n", test->name);
+            failures++;
+            continue;
+        }
+
+        Uint32 started = SDL_GetTicks();
+        long long nodes = perft(&board, test->depth);
+        bool ok = nodes == test->expected;
+        printf("prof. %d: %9lld (esperado %9lld) %-4s %6.2f s  %s\n", test->depth, nodes, test->expected,
+               ok ? "ok" : "ERRO", (SDL_GetTicks() - started) / 1000.0, test->name);
+        if (!ok) failures++;
+    }
+
+    if (failures > 0) {
+        printf("\n%d posição(ões) com contagem errada\n", failures);
+        return 1;
+    }
+    printf("\nTodas as contagens conferem\n");
+    return 0;
+}
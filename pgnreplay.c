@@ -0,0 +1,342 @@
+#include "chess_engine.h"
+
+// Validação do gerador de lances com partidas reais (PGN)
+// O arquivo é lido em blocos de tamanho fixo; cada bloco é cortado no início
+// da última partida completa ("[Event" no começo de uma linha) e o resto
+// passa para o próximo bloco. Os blocos são reproduzidos pelo pool de
+// threads: cada lance SAN é resolvido com parseSAN e jogado com
+// isValidMove/makeMove. A memória fica limitada a blocos por worker,
+// qualquer que seja o tamanho do arquivo.
+
+#define PGN_DEFAULT_CHUNK_KB 1024
+#define PGN_CHUNKS_PER_WORKER 2
+#define PGN_MAX_REPORTS 20
+
+typedef struct PgnReplay PgnReplay;
+
+// Totais de 64 bits: somados por bloco em releaseChunk, sob freeLock
+typedef struct {
+    long long games;
+    long long moves;
+    long long bytes;
+} PgnTotals;
+
+typedef struct {
+    PgnReplay* replay;
+    char* data;
+    size_t begin;               // Início da primeira partida (pula o fim de uma partida grande demais)
+    size_t length;
+    long long offset;           // Posição de data[0] no arquivo
+} PgnChunk;
+
+struct PgnReplay {
+    PgnChunk* chunks;
+    int chunkCount;
+    size_t chunkSize;
+    int* freeList;              // Blocos livres (pilha protegida por freeLock)
+    int freeCount;
+    SDL_mutex* freeLock;
+    SDL_sem* freeChunks;
+    SDL_mutex* reportLock;
+    int reports;
+    PgnTotals totals;           // Protegido por freeLock
+    SDL_atomic_t illegal;
+    SDL_atomic_t desyncs;
+    SDL_atomic_t invalidHeaders;
+};
+
+static bool isGameStart(const char* data, size_t position) {
+    return (position == 0 || data[position - 1] == '\n') && strncmp(data + position, "[Event ", 7) == 0;
+}
+
+// Última partida que começa depois da posição 0 (0 = nenhuma)
+static size_t findLastGameStart(const char* data, size_t length) {
+    for (size_t position = length > 7 ? length - 7 : 0; position > 0; position--) {
+        if (isGameStart(data, position)) {
+            return position;
+        }
+    }
+    return 0;
+}
+
+static const char* findNextGameStart(const char* data, const char* cursor, const char* end) {
+    for (; cursor + 7 <= end; cursor++) {
+        if (*cursor == '[' && isGameStart(data, (size_t)(cursor - data))) {
+            return cursor;
+        }
+    }
+    return end;
+}
+
+// ply = lance da partida em que o problema apareceu; a FEN é a posição atual
+static void reportProblem(PgnReplay* replay, const char* kind, long long offset,
+                          ChessBoard* board, int ply, const char* san) {
+    SDL_LockMutex(replay->reportLock);
+    if (replay->reports++ < PGN_MAX_REPORTS) {
+        char fen[FEN_MAX_LENGTH];
+        boardToFEN(board, fen);
+        printf("  %s no byte %lld: %d%s %s\n    FEN: %s\n", kind, offset,
+               ply / 2 + 1, ply % 2 == 0 ? "." : "...",
+               san, fen);
+    }
+    SDL_UnlockMutex(replay->reportLock);
+}
+
+// Reproduz uma partida; retorna o número de lances aceitos
+static int replayGame(PgnReplay* replay, PgnChunk* chunk, const char** cursor, const char* end) {
+    const char* gameStart = *cursor;
+    long long offset = chunk->offset + (gameStart - chunk->data);
+    ChessBoard board;
+
+    *cursor = parsePGNHeader(gameStart, end, &board);
+    if (!*cursor) {
+        SDL_AtomicAdd(&replay->invalidHeaders, 1);
+        *cursor = findNextGameStart(chunk->data, gameStart + 1, end);
+        return 0;
+    }
+
+    char san[SAN_MAX_LENGTH];
+    int plies = 0;
+    while (nextPGNMove(cursor, end, san)) {
+        Move move;
+        int ply = board.moveCount;
+        if (!parseSAN(&board, san, &move)) {
+            SDL_AtomicAdd(&replay->illegal, 1);
+            reportProblem(replay, "Lance ilegal", offset, &board, ply, san);
+            *cursor = findNextGameStart(chunk->data, *cursor, end);
+            break;
+        }
+
+        // Caminho da interface: o lance legal precisa ser aceito por isValidMove
+        if (!isValidMove(&board, move.from, move.to)) {
+            SDL_AtomicAdd(&replay->desyncs, 1);
+            reportProblem(replay, "isValidMove recusou", offset, &board, ply, san);
+            *cursor = findNextGameStart(chunk->data, *cursor, end);
+            break;
+        }
+        makeMove(&board, move.from, move.to);
+        if (move.promotion != PIECE_NONE) {
+            board.board[move.to.x][move.to.y].type = move.promotion;   // makeMove sempre promove a dama
+        }
+        plies++;
+
+        // Xeque e mate anotados precisam bater com as regras
+        bool annotatedMate = strchr(san, '#') != NULL;
+        bool annotatedCheck = annotatedMate || strchr(san, '+') != NULL;
+        if (annotatedCheck != isKingInCheck(&board, board.currentPlayer) ||
+            (annotatedMate && getGameStatus(&board) != GAME_CHECKMATE)) {
+            SDL_AtomicAdd(&replay->desyncs, 1);
+            reportProblem(replay, "Xeque anotado diferente", offset, &board, ply, san);
+        }
+    }
+    return plies;
+}
+
+// Devolve o bloco e soma o que ele rendeu (uma trava por bloco)
+static void releaseChunk(PgnReplay* replay, PgnChunk* chunk, int games, int plies) {
+    SDL_LockMutex(replay->freeLock);
+    replay->freeList[replay->freeCount++] = (int)(chunk - replay->chunks);
+    replay->totals.games += games;
+    replay->totals.moves += plies;
+    replay->totals.bytes += (long long)chunk->length;
+    SDL_UnlockMutex(replay->freeLock);
+    SDL_SemPost(replay->freeChunks);
+}
+
+// Tarefa: todas as partidas de um bloco
+static void replayChunk(ThreadPool* pool, int worker, void* data) {
+    (void)pool;
+    (void)worker;
+    PgnChunk* chunk = (PgnChunk*)data;
+    PgnReplay* replay = chunk->replay;
+    const char* cursor = chunk->data + chunk->begin;
+    const char* end = chunk->data + chunk->length;
+    int games = 0, plies = 0;
+
+    while (cursor < end) {
+        const char* before = cursor;
+        plies += replayGame(replay, chunk, &cursor, end);
+        games++;
+        if (cursor <= before) {
+            cursor = findNextGameStart(chunk->data, before + 1, end);
+        }
+        while (cursor < end && (*cursor == ' ' || *cursor == '\r' || *cursor == '\n' || *cursor == '\t')) {
+            cursor++;
+        }
+    }
+
+    releaseChunk(replay, chunk, games, plies);
+}
+
+static PgnTotals readTotals(PgnReplay* replay) {
+    SDL_LockMutex(replay->freeLock);
+    PgnTotals totals = replay->totals;
+    SDL_UnlockMutex(replay->freeLock);
+    return totals;
+}
+
+static void printProgress(PgnReplay* replay, Uint32 elapsedMs) {
+    double seconds = elapsedMs / 1000.0;
+    PgnTotals totals = readTotals(replay);
+    double games = (double)totals.games;
+    double megabytes = totals.bytes / (1024.0 * 1024.0);
+    printf("  %.0f partidas, %.1f MB (%.0f partidas/s, %.1f MB/s)\n", games, megabytes,
+           seconds > 0 ? games / seconds : 0.0, seconds > 0 ? megabytes / seconds : 0.0);
+    fflush(stdout);
+}
+
+static void printReplayUsage(void) {
+    printf("Uso: matecheck-pgn [opções] arquivo.pgn\n");
+    printf("  -t THREADS  Threads de trabalho (padrão: todos os núcleos)\n");
+    printf("  -b KB       Tamanho de cada bloco lido (padrão: %d)\n", PGN_DEFAULT_CHUNK_KB);
+}
+
+int main(int argc, char* argv[]) {
+    const char* inputPath = NULL;
+    int threads = 0;
+    long chunkKB = PGN_DEFAULT_CHUNK_KB;
+
+    for (int i = 1; i < argc; i++) {
+        if (i + 1 < argc && strcmp(argv[i], "-t") == 0) {
+            threads = atoi(argv[++i]);
+        } else if (i + 1 < argc && strcmp(argv[i], "-b") == 0) {
+            chunkKB = atol(argv[++i]);
+        } else if ((argv[i][0] != '-' || strcmp(argv[i], "-") == 0) && !inputPath) {
+            inputPath = argv[i];
+        } else {
+            printReplayUsage();
+            return strcmp(argv[i], "-h") == 0 ? 0 : 1;
+        }
+    }
+    if (!inputPath || chunkKB < 4) {
+        printReplayUsage();
+        return 1;
+    }
+
+    FILE* input = strcmp(inputPath, "-") == 0 ? stdin : fopen(inputPath, "rb");
+    if (!input) {
+        printf("Erro ao abrir %s\n", inputPath);
+        return 1;
+    }
+
+    ThreadPool* pool = createThreadPool(threads);
+    if (!pool) {
+        printf("Erro ao criar o pool de threads\n");
+        return 1;
+    }
+
+    static PgnReplay replay;
+    int workers = getThreadPoolSize(pool);
+    replay.chunkSize = (size_t)chunkKB * 1024;
+    replay.chunkCount = workers * PGN_CHUNKS_PER_WORKER;
+    replay.chunks = (PgnChunk*)calloc((size_t)replay.chunkCount, sizeof(PgnChunk));
+    replay.freeList = (int*)calloc((size_t)replay.chunkCount, sizeof(int));
+    char* carry = (char*)malloc(replay.chunkSize);
+    bool ok = replay.chunks && replay.freeList && carry;
+    for (int i = 0; ok && i < replay.chunkCount; i++) {
+        replay.chunks[i].replay = &replay;
+        replay.chunks[i].data = (char*)malloc(replay.chunkSize);
+        ok = replay.chunks[i].data != NULL;
+        replay.freeList[replay.freeCount++] = i;
+    }
+    if (!ok) {
+        printf("Memória insuficiente para %d blocos de %ld KB\n", replay.chunkCount, chunkKB);
+        return 1;
+    }
+    replay.freeLock = SDL_CreateMutex();
+    replay.reportLock = SDL_CreateMutex();
+    replay.freeChunks = SDL_CreateSemaphore((Uint32)replay.chunkCount);
+
+    printf("Reproduzindo %s com %d threads (%d blocos de %ld KB)...\n",
+           inputPath, workers, replay.chunkCount, chunkKB);
+
+    Uint32 startTime = SDL_GetTicks();
+    Uint32 lastReport = startTime;
+    size_t carryLength = 0;
+    long long chunkOffset = 0;      // Posição no arquivo do próximo bloco
+    bool skipping = false;          // Dentro de uma partida maior que o bloco
+    int oversized = 0;
+    bool finished = false;
+
+    while (!finished) {
+        // Esperar um bloco livre mostrando o progresso a cada segundo
+        bool acquired = false;
+        while (!acquired) {
+            acquired = SDL_SemWaitTimeout(replay.freeChunks, 250) == 0;
+            if (SDL_GetTicks() - lastReport >= 1000) {
+                printProgress(&replay, SDL_GetTicks() - startTime);
+                lastReport = SDL_GetTicks();
+            }
+        }
+        SDL_LockMutex(replay.freeLock);
+        PgnChunk* chunk = &replay.chunks[replay.freeList[--replay.freeCount]];
+        SDL_UnlockMutex(replay.freeLock);
+
+        memcpy(chunk->data, carry, carryLength);
+        size_t wanted = replay.chunkSize - carryLength;
+        size_t got = fread(chunk->data + carryLength, 1, wanted, input);
+        size_t length = carryLength + got;
+        finished = got < wanted;
+
+        chunk->offset = chunkOffset;
+        chunk->begin = 0;
+        size_t split = finished ? length : findLastGameStart(chunk->data, length);
+        if (skipping && isGameStart(chunk->data, 0)) {
+            skipping = false;       // A partida grande acabou junto com o bloco anterior
+        }
+        if (skipping) {
+            // O começo do bloco ainda é a partida grande demais
+            const char* next = findNextGameStart(chunk->data, chunk->data, chunk->data + split);
+            chunk->begin = (size_t)(next - chunk->data);
+        }
+        if (split == 0 && !finished) {
+            // Uma partida ocupa o bloco inteiro: descartar até a próxima
+            if (!skipping) oversized++;
+            skipping = true;
+            split = length;
+            chunk->begin = length;
+        } else {
+            skipping = false;       // O resto levado adiante começa numa partida
+        }
+
+        carryLength = length - split;
+        memcpy(carry, chunk->data + split, carryLength);
+        chunk->length = split;
+        chunkOffset += (long long)split;
+
+        if (!submitTask(pool, -1, replayChunk, chunk)) {
+            replayChunk(pool, -1, chunk);
+        }
+    }
+
+    while (!waitThreadPool(pool, 250)) {}
+    Uint32 elapsed = SDL_GetTicks() - startTime;
+    destroyThreadPool(pool);
+    if (input != stdin) fclose(input);
+
+    double seconds = elapsed / 1000.0;
+    PgnTotals totals = replay.totals;       // Workers já encerrados
+    double games = (double)totals.games;
+    double megabytes = chunkOffset / (1024.0 * 1024.0);
+    printf("\nPartidas: %lld (%lld lances)\n", totals.games, totals.moves);
+    printf("Lances ilegais: %d\n", SDL_AtomicGet(&replay.illegal));
+    printf("Divergências: %d\n", SDL_AtomicGet(&replay.desyncs));
+    if (SDL_AtomicGet(&replay.invalidHeaders) || oversized) {
+        printf("Cabeçalhos inválidos: %d, partidas maiores que o bloco: %d\n",
+               SDL_AtomicGet(&replay.invalidHeaders), oversized);
+    }
+    printf("Tempo: %.2f s (%.0f partidas/s, %.1f MB/s)\n", seconds,
+           seconds > 0 ? games / seconds : 0.0, seconds > 0 ? megabytes / seconds : 0.0);
+
+    for (int i = 0; i < replay.chunkCount; i++) {
+        free(replay.chunks[i].data);
+    }
+    free(replay.chunks);
+    free(replay.freeList);
+    free(carry);
+    SDL_DestroySemaphore(replay.freeChunks);
+    SDL_DestroyMutex(replay.freeLock);
+    SDL_DestroyMutex(replay.reportLock);
+
+    return SDL_AtomicGet(&replay.illegal) || SDL_AtomicGet(&replay.desyncs) ? 2 : 0;
+}
@@ -32,6 +32,17 @@ void getPawnMoves(ChessBoard* board, Position pos, Position moves[], int* count)
             }
         }
     }
+    
+    // En passant: a casa pulada pelo avanço duplo anterior, com o peão ao lado
+    int passedRow = (piece->color == COLOR_WHITE_PIECE) ? 3 : 4;
+    Position target = board->enPassant;
+    if (pos.y == passedRow && target.y == passedRow + direction && abs(target.x - pos.x) == 1) {
+        Piece* passed = &board->board[target.x][pos.y];
+        if (passed->type == PIECE_PAWN && passed->color != piece->color &&
+            isPositionEmpty(board, target)) {
+            moves[(*count)++] = target;
+        }
+    }
 }
 
 void getRookMoves(ChessBoard* board, Position pos, Position moves[], int* count) {
@@ -151,4 +162,32 @@ void getKingMoves(ChessBoard* board, Position pos, Position moves[], int* count)
             }
         }
     }
+    
+    // Roque: rei e torre sem mover, casas entre eles vazias e o rei não
+    // pode estar, passar ou parar em casa atacada
+    int homeRow = (piece->color == COLOR_WHITE_PIECE) ? BOARD_SIZE - 1 : 0;
+    if (piece->type != PIECE_KING || piece->hasMoved || pos.x != 4 || pos.y != homeRow ||
+        isSquareAttacked(board, pos, !piece->color)) {
+        return;
+    }
+    
+    for (int side = 0; side < 2; side++) {
+        int rookX = side == 0 ? BOARD_SIZE - 1 : 0;
+        int direction = side == 0 ? 1 : -1;
+        Piece* rook = &board->board[rookX][homeRow];
+        if (rook->type != PIECE_ROOK || rook->color != piece->color || rook->hasMoved) continue;
+        
+        bool clear = true;
+        for (int x = pos.x + direction; x != rookX && clear; x += direction) {
+            clear = board->board[x][homeRow].type == PIECE_NONE;
+        }
+        for (int step = 1; step <= 2 && clear; step++) {
+            Position crossed = {pos.x + step * direction, homeRow};
+            clear = !isSquareAttacked(board, crossed, !piece->color);
+        }
+        if (clear) {
+            Position castle = {pos.x + 2 * direction, homeRow};
+            moves[(*count)++] = castle;
+        }
+    }
 }
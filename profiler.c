@@ -0,0 +1,122 @@
+#include "chess_engine.h"
+
+// Perfilador de quadros
+// Os estágios do laço principal são medidos com PROFILE_BEGIN/PROFILE_END e os
+// tempos dos últimos PROFILE_HISTORY quadros ficam num buffer circular, de onde
+// saem o gráfico e as medianas (p50/p99) do HUD. Sem ENABLE_PROFILING ou
+// DEBUG_PERFORMANCE este arquivo fica vazio e as macros não geram código.
+
+#ifdef PROFILING_ENABLED
+
+#define PROFILE_HUD_X 10
+#define PROFILE_HUD_Y 10
+#define PROFILE_GRAPH_HEIGHT 60
+#define PROFILE_GRAPH_MAX_MS 33.3f      // Topo do gráfico (30 FPS)
+#define PROFILE_TEXT_INTERVAL 30        // Quadros entre atualizações dos números
+
+static const char* stageNames[PROFILE_STAGE_COUNT] = {
+    "Eventos", "Tabuleiro", "UI", "Texto", "Present"
+};
+
+static float frameTimes[PROFILE_HISTORY];
+static float stageTimes[PROFILE_HISTORY][PROFILE_STAGE_COUNT];
+static float currentStages[PROFILE_STAGE_COUNT];
+static int frameCount = 0;
+static int frameIndex = 0;
+static Uint64 frameStart = 0;
+static char summaryText[PROFILE_STAGE_COUNT + 1][64];
+
+static float ticksToMs(Uint64 ticks) {
+    return (float)((double)ticks * 1000.0 / (double)SDL_GetPerformanceFrequency());
+}
+
+void profileAddTime(ProfileStage stage, Uint64 ticks) {
+    currentStages[stage] += ticksToMs(ticks);
+}
+
+void profileBeginFrame(void) {
+    frameStart = SDL_GetPerformanceCounter();
+    memset(currentStages, 0, sizeof(currentStages));
+}
+
+static int compareFloats(const void* a, const void* b) {
+    float x = *(const float*)a;
+    float y = *(const float*)b;
+    return (x > y) - (x < y);
+}
+
+// Percentil dos tempos guardados (ordena uma cópia)
+static float percentile(const float* values, int count, float p) {
+    float sorted[PROFILE_HISTORY];
+    memcpy(sorted, values, sizeof(float) * count);
+    qsort(sorted, count, sizeof(float), compareFloats);
+    int index = (int)(p * (count - 1) + 0.5f);
+    return sorted[index];
+}
+
+static void updateSummary(void) {
+    int count = frameCount < PROFILE_HISTORY ? frameCount : PROFILE_HISTORY;
+    float stageColumn[PROFILE_HISTORY];
+
+    snprintf(summaryText[0], sizeof(summaryText[0]), "Quadro p50 %.2f ms  p99 %.2f ms",
+             percentile(frameTimes, count, 0.5f), percentile(frameTimes, count, 0.99f));
+
+    for (int stage = 0; stage < PROFILE_STAGE_COUNT; stage++) {
+        for (int i = 0; i < count; i++) {
+            stageColumn[i] = stageTimes[i][stage];
+        }
+        snprintf(summaryText[stage + 1], sizeof(summaryText[stage + 1]), "%s p50 %.2f  p99 %.2f",
+                 stageNames[stage], percentile(stageColumn, count, 0.5f),
+                 percentile(stageColumn, count, 0.99f));
+    }
+}
+
+void profileEndFrame(void) {
+    frameTimes[frameIndex] = ticksToMs(SDL_GetPerformanceCounter() - frameStart);
+    memcpy(stageTimes[frameIndex], currentStages, sizeof(currentStages));
+    frameIndex = (frameIndex + 1) % PROFILE_HISTORY;
+    frameCount++;
+
+    // Os textos mudam pouco: atualizar de vez em quando poupa o cache de texto
+    if (frameCount % PROFILE_TEXT_INTERVAL == 1) {
+        updateSummary();
+    }
+}
+
+void drawProfilerHUD(ChessGame* game) {
+    int count = frameCount < PROFILE_HISTORY ? frameCount : PROFILE_HISTORY;
+    if (count == 0) return;
+
+    SDL_Rect background = {PROFILE_HUD_X, PROFILE_HUD_Y, PROFILE_HISTORY, PROFILE_GRAPH_HEIGHT};
+    SDL_SetRenderDrawBlendMode(game->renderer, SDL_BLENDMODE_BLEND);
+    SDL_SetRenderDrawColor(game->renderer, 0, 0, 0, 160);
+    SDL_RenderFillRect(game->renderer, &background);
+    SDL_SetRenderDrawBlendMode(game->renderer, SDL_BLENDMODE_NONE);
+
+    // Linha de referência em 1/FPS
+    int budgetY = PROFILE_HUD_Y + PROFILE_GRAPH_HEIGHT -
+                  (int)(1000.0f / FPS / PROFILE_GRAPH_MAX_MS * PROFILE_GRAPH_HEIGHT);
+    SDL_SetRenderDrawColor(game->renderer, 255, 0, 0, 255);
+    SDL_RenderDrawLine(game->renderer, PROFILE_HUD_X, budgetY,
+                       PROFILE_HUD_X + PROFILE_HISTORY - 1, budgetY);
+
+    // Gráfico do mais antigo (esquerda) ao mais recente (direita), uma única chamada
+    SDL_Point points[PROFILE_HISTORY];
+    int oldest = frameCount < PROFILE_HISTORY ? 0 : frameIndex;
+    for (int i = 0; i < count; i++) {
+        float ms = frameTimes[(oldest + i) % PROFILE_HISTORY];
+        if (ms > PROFILE_GRAPH_MAX_MS) ms = PROFILE_GRAPH_MAX_MS;
+        points[i].x = PROFILE_HUD_X + i;
+        points[i].y = PROFILE_HUD_Y + PROFILE_GRAPH_HEIGHT - (int)(ms / PROFILE_GRAPH_MAX_MS * PROFILE_GRAPH_HEIGHT);
+    }
+    SDL_SetRenderDrawColor(game->renderer, 0, 255, 0, 255);
+    SDL_RenderDrawLines(game->renderer, points, count);
+
+    // O texto do HUD também entra no estágio Texto
+    for (int i = 0; i <= PROFILE_STAGE_COUNT; i++) {
+        drawText(game, summaryText[i], PROFILE_HUD_X + PROFILE_HISTORY + 10,
+                 PROFILE_HUD_Y + i * 16, i == 0 ? COLOR_HIGHLIGHT : COLOR_WHITE);
+    }
+}
+
+#endif
@@ -0,0 +1,189 @@
+#include "chess_engine.h"
+
+// Gerador de problemas de mate em N lances
+// Sorteia posições legais, prova o mate com a busca exclusiva de mate e
+// guarda apenas os problemas com solução única. O trabalho é dividido em
+// lotes espalhados por todos os núcleos com o pool de roubo de trabalho.
+
+#define PUZZLE_BATCH 64
+#define TASKS_PER_WORKER 4
+
+typedef struct {
+    int mateDepth;
+    long target;
+    Uint32 timeLimitMs;
+    Uint32 startTime;
+    Uint64 seed;
+    FILE* output;
+    SDL_mutex* outputLock;
+    SDL_atomic_t found;
+    SDL_atomic_t sampled;
+    SDL_atomic_t proven;
+    SDL_atomic_t nextBatch;
+    long long nodes;                // Protegido por outputLock (64 bits não é atômico)
+} PuzzleGenerator;
+
+static long long totalNodes(PuzzleGenerator* generator) {
+    SDL_LockMutex(generator->outputLock);
+    long long total = generator->nodes;
+    SDL_UnlockMutex(generator->outputLock);
+    return total;
+}
+
+static bool generatorFinished(PuzzleGenerator* generator) {
+    if (SDL_AtomicGet(&generator->found) >= generator->target) {
+        return true;
+    }
+    return generator->timeLimitMs > 0 &&
+           SDL_GetTicks() - generator->startTime >= generator->timeLimitMs;
+}
+
+// Tarefa: testar um lote de posições e, se ainda faltar, reenviar a si mesma
+static void generatePuzzleBatch(ThreadPool* pool, int worker, void* data) {
+    PuzzleGenerator* generator = (PuzzleGenerator*)data;
+    if (generatorFinished(generator)) {
+        return;
+    }
+
+    // Cada lote tem sua própria semente: a saída é reproduzível por lote
+    Uint64 rng = generator->seed ^ ((Uint64)SDL_AtomicAdd(&generator->nextBatch, 1) * 0x9E3779B97F4A7C15ULL);
+    if (rng == 0) rng = 1;
+
+    ChessBoard board;
+    long long nodes = 0;
+    for (int i = 0; i < PUZZLE_BATCH; i++) {
+        if (!sampleMatePosition(&board, &rng)) continue;
+        SDL_AtomicAdd(&generator->sampled, 1);
+
+        Move solution;
+        int solutions = countMateSolutions(&board, generator->mateDepth, &solution, &nodes);
+        if (solutions >= 1) {
+            SDL_AtomicAdd(&generator->proven, 1);
+        }
+        if (solutions != 1) continue;
+
+        unsigned char record[PUZZLE_RECORD_SIZE];
+        encodePuzzle(&board, generator->mateDepth, solution, record);
+
+        SDL_LockMutex(generator->outputLock);
+        if (SDL_AtomicGet(&generator->found) < generator->target) {
+            fwrite(record, 1, PUZZLE_RECORD_SIZE, generator->output);
+            SDL_AtomicAdd(&generator->found, 1);
+        }
+        SDL_UnlockMutex(generator->outputLock);
+    }
+    // Uma vez por lote: a trava não pesa perto da busca
+    SDL_LockMutex(generator->outputLock);
+    generator->nodes += nodes;
+    SDL_UnlockMutex(generator->outputLock);
+
+    if (!generatorFinished(generator)) {
+        if (!submitTask(pool, worker, generatePuzzleBatch, generator)) {
+            generatePuzzleBatch(pool, worker, generator);
+        }
+    }
+}
+
+static void printPuzzleUsage(void) {
+    printf("Uso: matecheck-puzzles [opções]\n");
+    printf("  -n N          Mate em N lances (padrão: 2)\n");
+    printf("  -c QUANTIDADE Número de problemas (padrão: 100)\n");
+    printf("  -t THREADS    Threads de trabalho (padrão: todos os núcleos)\n");
+    printf("  -o ARQUIVO    Arquivo de saída (padrão: puzzles.mcpz)\n");
+    printf("  -s SEMENTE    Semente do sorteio\n");
+    printf("  -l SEGUNDOS   Tempo máximo de geração (0 = sem limite)\n");
+}
+
+int main(int argc, char* argv[]) {
+    PuzzleGenerator generator = {0};
+    const char* outputPath = "puzzles.mcpz";
+    int threads = 0;
+
+    generator.mateDepth = 2;
+    generator.target = 100;
+    generator.seed = 20240601;
+
+    for (int i = 1; i < argc; i++) {
+        if (i + 1 < argc && strcmp(argv[i], "-n") == 0) {
+            generator.mateDepth = atoi(argv[++i]);
+        } else if (i + 1 < argc && strcmp(argv[i], "-c") == 0) {
+            generator.target = atol(argv[++i]);
+        } else if (i + 1 < argc && strcmp(argv[i], "-t") == 0) {
+            threads = atoi(argv[++i]);
+        } else if (i + 1 < argc && strcmp(argv[i], "-o") == 0) {
+            outputPath = argv[++i];
+        } else if (i + 1 < argc && strcmp(argv[i], "-s") == 0) {
+            generator.seed = (Uint64)strtoull(argv[++i], NULL, 10);
+        } else if (i + 1 < argc && strcmp(argv[i], "-l") == 0) {
+            generator.timeLimitMs = (Uint32)(atof(argv[++i]) * 1000);
+        } else {
+            printPuzzleUsage();
+            return strcmp(argv[i], "-h") == 0 ? 0 : 1;
+        }
+    }
+
+    if (generator.mateDepth < 1 || generator.mateDepth > 127 || generator.target <= 0) {
+        printPuzzleUsage();
+        return 1;
+    }
+
+    generator.output = fopen(outputPath, "wb");
+    if (!generator.output) {
+        printf("Erro ao criar %s\n", outputPath);
+        return 1;
+    }
+    writePuzzleHeader(generator.output, 0);
+    generator.outputLock = SDL_CreateMutex();
+
+    ThreadPool* pool = createThreadPool(threads);
+    if (!pool) {
+        printf("Erro ao criar o pool de threads\n");
+        fclose(generator.output);
+        return 1;
+    }
+
+    int workers = getThreadPoolSize(pool);
+    printf("Gerando %ld problemas de mate em %d com %d threads...\n",
+           generator.target, generator.mateDepth, workers);
+
+    generator.startTime = SDL_GetTicks();
+    for (int i = 0; i < workers * TASKS_PER_WORKER; i++) {
+        submitTask(pool, -1, generatePuzzleBatch, &generator);
+    }
+
+    // Relatório de progresso a cada segundo
+    Uint32 lastReport = generator.startTime;
+    while (!waitThreadPool(pool, 250)) {
+        Uint32 now = SDL_GetTicks();
+        if (now - lastReport >= 1000) {
+            double minutes = (now - generator.startTime) / 60000.0;
+            int found = SDL_AtomicGet(&generator.found);
+            printf("  %d/%ld problemas, %d posições (%.1f problemas/min, %.1f mil nós/s)\n",
+                   found, generator.target, SDL_AtomicGet(&generator.sampled),
+                   minutes > 0 ? found / minutes : 0.0, totalNodes(&generator) / (minutes * 60000.0));
+            fflush(stdout);
+            lastReport = now;
+        }
+    }
+
+    Uint32 elapsed = SDL_GetTicks() - generator.startTime;
+    int found = SDL_AtomicGet(&generator.found);
+    int steals = getThreadPoolSteals(pool);
+    destroyThreadPool(pool);
+
+    // Gravar a quantidade final no cabeçalho
+    fseek(generator.output, 0, SEEK_SET);
+    writePuzzleHeader(generator.output, (Uint32)found);
+    fclose(generator.output);
+    SDL_DestroyMutex(generator.outputLock);
+
+    double minutes = elapsed / 60000.0;
+    printf("\nProblemas gravados: %d em %s\n", found, outputPath);
+    printf("Posições sorteadas: %d (%d com mate forçado)\n",
+           SDL_AtomicGet(&generator.sampled), SDL_AtomicGet(&generator.proven));
+    long long nodes = generator.nodes;      // Workers já encerrados
+    printf("Nós da busca: %lld (%.1f mil nós/s)\n", nodes, elapsed > 0 ? nodes / (double)elapsed : 0.0);
+    printf("Tempo: %.1f s (%.1f problemas/min, %d roubos de tarefa)\n",
+           elapsed / 1000.0, minutes > 0 ? found / minutes : 0.0, steals);
+    return 0;
+}
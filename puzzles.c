@@ -0,0 +1,240 @@
+#include "chess_engine.h"
+
+// Problemas de mate em N lances
+// Busca exclusiva de mate (sem avaliação), sorteio de posições legais e o
+// formato compacto dos arquivos de problemas.
+
+// Gerador pseudoaleatório simples (xorshift64*), um estado por thread
+static Uint64 nextRandom(Uint64* state) {
+    *state ^= *state >> 12;
+    *state ^= *state << 25;
+    *state ^= *state >> 27;
+    return *state * 2685821657736338717ULL;
+}
+
+static int randomRange(Uint64* state, int limit) {
+    return (int)((nextRandom(state) >> 33) % (Uint64)limit);
+}
+
+void clearBoard(ChessBoard* board) {
+    for (int i = 0; i < BOARD_SIZE; i++) {
+        for (int j = 0; j < BOARD_SIZE; j++) {
+            board->board[i][j].type = PIECE_NONE;
+            board->board[i][j].color = COLOR_WHITE_PIECE;
+            board->board[i][j].pos.x = i;
+            board->board[i][j].pos.y = j;
+            board->board[i][j].hasMoved = false;
+        }
+    }
+    board->isSelected = false;
+    board->currentPlayer = COLOR_WHITE_PIECE;
+    board->moveCount = 0;
+    board->enPassant.x = -1;
+    board->enPassant.y = -1;
+    board->halfmoveClock = 0;
+}
+
+static bool placeRandomPiece(ChessBoard* board, Uint64* rng, PieceType type, PieceColor color) {
+    for (int attempt = 0; attempt < 64; attempt++) {
+        int x = randomRange(rng, BOARD_SIZE);
+        int y = randomRange(rng, BOARD_SIZE);
+
+        // Peões nunca ficam na primeira ou na última linha
+        if (type == PIECE_PAWN && (y == 0 || y == BOARD_SIZE - 1)) continue;
+        if (board->board[x][y].type != PIECE_NONE) continue;
+
+        board->board[x][y].type = type;
+        board->board[x][y].color = color;
+        board->board[x][y].hasMoved = true;
+        return true;
+    }
+    return false;
+}
+
+// Sorteia uma posição legal com as brancas para jogar
+bool sampleMatePosition(ChessBoard* board, Uint64* rng) {
+    static const PieceType attackers[] = {PIECE_QUEEN, PIECE_ROOK, PIECE_ROOK, PIECE_BISHOP,
+                                          PIECE_KNIGHT, PIECE_PAWN};
+    static const PieceType defenders[] = {PIECE_ROOK, PIECE_BISHOP, PIECE_KNIGHT,
+                                          PIECE_PAWN, PIECE_PAWN};
+
+    clearBoard(board);
+
+    Position whiteKing = {randomRange(rng, BOARD_SIZE), randomRange(rng, BOARD_SIZE)};
+    Position blackKing = {randomRange(rng, BOARD_SIZE), randomRange(rng, BOARD_SIZE)};
+    if (abs(whiteKing.x - blackKing.x) <= 1 && abs(whiteKing.y - blackKing.y) <= 1) {
+        return false;
+    }
+    board->board[whiteKing.x][whiteKing.y].type = PIECE_KING;
+    board->board[whiteKing.x][whiteKing.y].color = COLOR_WHITE_PIECE;
+    board->board[blackKing.x][blackKing.y].type = PIECE_KING;
+    board->board[blackKing.x][blackKing.y].color = COLOR_BLACK_PIECE;
+
+    int whiteExtras = 1 + randomRange(rng, 3);
+    int blackExtras = randomRange(rng, 3);
+    for (int i = 0; i < whiteExtras; i++) {
+        PieceType type = attackers[randomRange(rng, (int)(sizeof(attackers) / sizeof(attackers[0])))];
+        if (!placeRandomPiece(board, rng, type, COLOR_WHITE_PIECE)) return false;
+    }
+    for (int i = 0; i < blackExtras; i++) {
+        PieceType type = defenders[randomRange(rng, (int)(sizeof(defenders) / sizeof(defenders[0])))];
+        if (!placeRandomPiece(board, rng, type, COLOR_BLACK_PIECE)) return false;
+    }
+
+    // O lado que não joga não pode estar em xeque
+    return !isKingInCheck(board, COLOR_BLACK_PIECE);
+}
+
+static bool defenderIsMated(ChessBoard* board, int movesLeft, long long* nodes);
+
+// O lado da vez consegue dar mate em até movesLeft lances?
+static bool canForceMate(ChessBoard* board, int movesLeft, long long* nodes) {
+    Move moves[MAX_LEGAL_MOVES];
+    int count = generateLegalMoves(board, moves);
+    PieceColor defender = !board->currentPlayer;
+
+    for (int i = 0; i < count; i++) {
+        MoveUndo undo;
+        applyMove(board, moves[i], &undo);
+        (*nodes)++;
+
+        // No último lance só lances de xeque podem dar mate
+        bool mated = (movesLeft > 1 || isKingInCheck(board, defender)) &&
+                     defenderIsMated(board, movesLeft, nodes);
+        undoMove(board, &undo);
+        if (mated) return true;
+    }
+    return false;
+}
+
+// Todas as respostas do defensor levam a mate nos lances restantes?
+static bool defenderIsMated(ChessBoard* board, int movesLeft, long long* nodes) {
+    Move replies[MAX_LEGAL_MOVES];
+    int count = generateLegalMoves(board, replies);
+
+    if (count == 0) {
+        return isKingInCheck(board, board->currentPlayer);   // Afogamento não conta
+    }
+    if (movesLeft <= 1) {
+        return false;
+    }
+
+    for (int i = 0; i < count; i++) {
+        MoveUndo undo;
+        applyMove(board, replies[i], &undo);
+        (*nodes)++;
+        bool mated = canForceMate(board, movesLeft - 1, nodes);
+        undoMove(board, &undo);
+        if (!mated) return false;
+    }
+    return true;
+}
+
+// Conta quantos primeiros lances forçam mate em exatamente mateDepth lances.
+// Retorna -1 se já existe mate mais curto. solution recebe o primeiro encontrado.
+int countMateSolutions(ChessBoard* board, int mateDepth, Move* solution, long long* nodes) {
+    if (mateDepth > 1 && canForceMate(board, mateDepth - 1, nodes)) {
+        return -1;
+    }
+
+    Move moves[MAX_LEGAL_MOVES];
+    int count = generateLegalMoves(board, moves);
+    PieceColor defender = !board->currentPlayer;
+    int solutions = 0;
+
+    for (int i = 0; i < count; i++) {
+        MoveUndo undo;
+        applyMove(board, moves[i], &undo);
+        (*nodes)++;
+        bool mated = (mateDepth > 1 || isKingInCheck(board, defender)) &&
+                     defenderIsMated(board, mateDepth, nodes);
+        undoMove(board, &undo);
+
+        if (mated) {
+            if (solutions == 0 && solution) {
+                *solution = moves[i];
+            }
+            // Dois lances bastam para descartar o problema
+            if (++solutions > 1) break;
+        }
+    }
+    return solutions;
+}
+
+// === FORMATO DO ARQUIVO DE PROBLEMAS ===
+// Cabeçalho de 12 bytes ("MCPZ", versão, 3 bytes reservados, quantidade em
+// 32 bits little-endian) seguido de registros de PUZZLE_RECORD_SIZE bytes:
+// 32 bytes de tabuleiro (4 bits por casa: tipo | cor << 3, casa = y * 8 + x),
+// 1 byte com N do mate e o lado da vez no bit 7, e 2 bytes com a solução
+// (origem | destino << 6 | promoção << 12).
+
+unsigned int encodeMove(Move move) {
+    int from = move.from.y * BOARD_SIZE + move.from.x;
+    int to = move.to.y * BOARD_SIZE + move.to.x;
+    return (unsigned int)(from | (to << 6) | ((int)move.promotion << 12));
+}
+
+Move decodeMove(unsigned int code) {
+    Move move;
+    move.from.x = (int)(code & 63) % BOARD_SIZE;
+    move.from.y = (int)(code & 63) / BOARD_SIZE;
+    move.to.x = (int)((code >> 6) & 63) % BOARD_SIZE;
+    move.to.y = (int)((code >> 6) & 63) / BOARD_SIZE;
+    move.promotion = (PieceType)((code >> 12) & 7);
+    return move;
+}
+
+void encodePuzzle(ChessBoard* board, int mateDepth, Move solution, unsigned char record[PUZZLE_RECORD_SIZE]) {
+    memset(record, 0, PUZZLE_RECORD_SIZE);
+
+    for (int square = 0; square < BOARD_SIZE * BOARD_SIZE; square++) {
+        Piece* piece = &board->board[square % BOARD_SIZE][square / BOARD_SIZE];
+        int code = piece->type == PIECE_NONE ? 0 : (int)piece->type | ((int)piece->color << 3);
+        record[square / 2] |= (unsigned char)(code << ((square % 2) * 4));
+    }
+
+    record[32] = (unsigned char)((mateDepth & 0x7F) | (board->currentPlayer << 7));
+    unsigned int code = encodeMove(solution);
+    record[33] = (unsigned char)(code & 0xFF);
+    record[34] = (unsigned char)(code >> 8);
+}
+
+int decodePuzzle(const unsigned char record[PUZZLE_RECORD_SIZE], ChessBoard* board, Move* solution) {
+    clearBoard(board);
+
+    for (int square = 0; square < BOARD_SIZE * BOARD_SIZE; square++) {
+        int code = (record[square / 2] >> ((square % 2) * 4)) & 0x0F;
+        if ((code & 7) == PIECE_NONE) continue;
+
+        Piece* piece = &board->board[square % BOARD_SIZE][square / BOARD_SIZE];
+        piece->type = (PieceType)(code & 7);
+        piece->color = (PieceColor)(code >> 3);
+        piece->hasMoved = true;
+    }
+
+    board->currentPlayer = record[32] >> 7;
+    if (solution) {
+        *solution = decodeMove((unsigned int)record[33] | ((unsigned int)record[34] << 8));
+    }
+    return record[32] & 0x7F;
+}
+
+bool writePuzzleHeader(FILE* file, Uint32 count) {
+    unsigned char header[PUZZLE_HEADER_SIZE] = {'M', 'C', 'P', 'Z', PUZZLE_FILE_VERSION, 0, 0, 0,
+                                                (unsigned char)(count & 0xFF),
+                                                (unsigned char)((count >> 8) & 0xFF),
+                                                (unsigned char)((count >> 16) & 0xFF),
+                                                (unsigned char)((count >> 24) & 0xFF)};
+    return fwrite(header, 1, PUZZLE_HEADER_SIZE, file) == PUZZLE_HEADER_SIZE;
+}
+
+// Lê o cabeçalho e retorna a quantidade de problemas (-1 se inválido)
+long readPuzzleHeader(FILE* file) {
+    unsigned char header[PUZZLE_HEADER_SIZE];
+    if (fread(header, 1, PUZZLE_HEADER_SIZE, file) != PUZZLE_HEADER_SIZE ||
+        memcmp(header, "MCPZ", 4) != 0 || header[4] != PUZZLE_FILE_VERSION) {
+        return -1;
+    }
+    return (long)((Uint32)header[8] | ((Uint32)header[9] << 8) |
+                  ((Uint32)header[10] << 16) | ((Uint32)header[11] << 24));
+}
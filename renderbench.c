@@ -0,0 +1,343 @@
+#include "chess_engine.h"
+
+// Renderização sem janela e medição de chamadas de desenho
+// Desenha cenas fixas (menu, tabuleiro, seleção, busca, efeitos) com o
+// renderer por software numa superfície na memória, usando o driver de vídeo
+// "dummy" do SDL, então roda em servidores Linux sem tela. Para cada cena
+// mostra quadros por segundo e chamadas de desenho por quadro; com --dump
+// grava o último quadro em PPM e com --compare compara com quadros gravados.
+//
+// As chamadas são contadas por funções __wrap_* (opção --wrap do ligador, ver
+// o alvo render-bench do Makefile), sem mexer no código de desenho.
+
+#define BENCH_DEFAULT_FRAMES 300
+#define BENCH_PATH_LENGTH 512
+
+typedef struct {
+    const char* name;
+    void (*setup)(ChessGame* game);
+    bool menu;
+    bool deterministic;     // Sem relógio nem sorteio: pode virar imagem de referência
+} BenchScene;
+
+static long long drawCalls = 0;
+
+// === Contagem das chamadas de desenho ===
+
+int __real_SDL_RenderClear(SDL_Renderer* renderer);
+int __real_SDL_RenderCopy(SDL_Renderer* renderer, SDL_Texture* texture, const SDL_Rect* source, const SDL_Rect* dest);
+int __real_SDL_RenderFillRect(SDL_Renderer* renderer, const SDL_Rect* rect);
+int __real_SDL_RenderFillRects(SDL_Renderer* renderer, const SDL_Rect* rects, int count);
+int __real_SDL_RenderDrawRect(SDL_Renderer* renderer, const SDL_Rect* rect);
+int __real_SDL_RenderDrawRects(SDL_Renderer* renderer, const SDL_Rect* rects, int count);
+int __real_SDL_RenderDrawLine(SDL_Renderer* renderer, int x1, int y1, int x2, int y2);
+int __real_SDL_RenderDrawLines(SDL_Renderer* renderer, const SDL_Point* points, int count);
+int __real_SDL_RenderGeometry(SDL_Renderer* renderer, SDL_Texture* texture, const SDL_Vertex* vertices,
+                              int vertexCount, const int* indices, int indexCount);
+
+int __wrap_SDL_RenderClear(SDL_Renderer* renderer) {
+    drawCalls++;
+    return __real_SDL_RenderClear(renderer);
+}
+
+int __wrap_SDL_RenderCopy(SDL_Renderer* renderer, SDL_Texture* texture, const SDL_Rect* source, const SDL_Rect* dest) {
+    drawCalls++;
+    return __real_SDL_RenderCopy(renderer, texture, source, dest);
+}
+
+int __wrap_SDL_RenderFillRect(SDL_Renderer* renderer, const SDL_Rect* rect) {
+    drawCalls++;
+    return __real_SDL_RenderFillRect(renderer, rect);
+}
+
+int __wrap_SDL_RenderFillRects(SDL_Renderer* renderer, const SDL_Rect* rects, int count) {
+    drawCalls++;
+    return __real_SDL_RenderFillRects(renderer, rects, count);
+}
+
+int __wrap_SDL_RenderDrawRect(SDL_Renderer* renderer, const SDL_Rect* rect) {
+    drawCalls++;
+    return __real_SDL_RenderDrawRect(renderer, rect);
+}
+
+int __wrap_SDL_RenderDrawRects(SDL_Renderer* renderer, const SDL_Rect* rects, int count) {
+    drawCalls++;
+    return __real_SDL_RenderDrawRects(renderer, rects, count);
+}
+
+int __wrap_SDL_RenderDrawLine(SDL_Renderer* renderer, int x1, int y1, int x2, int y2) {
+    drawCalls++;
+    return __real_SDL_RenderDrawLine(renderer, x1, y1, x2, y2);
+}
+
+int __wrap_SDL_RenderDrawLines(SDL_Renderer* renderer, const SDL_Point* points, int count) {
+    drawCalls++;
+    return __real_SDL_RenderDrawLines(renderer, points, count);
+}
+
+int __wrap_SDL_RenderGeometry(SDL_Renderer* renderer, SDL_Texture* texture, const SDL_Vertex* vertices,
+                              int vertexCount, const int* indices, int indexCount) {
+    drawCalls++;
+    return __real_SDL_RenderGeometry(renderer, texture, vertices, vertexCount, indices, indexCount);
+}
+
+// === Cenas ===
+
+static void setupMenu(ChessGame* game) {
+    (void)game;
+}
+
+static void setupBoard(ChessGame* game) {
+    initBoard(&game->board);
+}
+
+static void setupSelection(ChessGame* game) {
+    initBoard(&game->board);
+    Position queen = {2, 2};
+    Position target = {7, 5};
+    game->board.selected = queen;
+    game->board.isSelected = true;
+    game->showMoves = true;
+    updateSelectedRoute(game, target);
+}
+
+static void setupSearch(ChessGame* game) {
+    initBoard(&game->board);
+    Position knight = {3, 3};
+    Position target = {7, 7};
+    game->difficulty = 2;
+    startVisualizer(&game->visualizer, SEARCH_BFS, knight, target);
+    advanceVisualizer(&game->visualizer, 24, 1000);
+}
+
+static void setupEffects(ChessGame* game) {
+    initBoard(&game->board);
+    Position from = {2, 2};
+    Position to = {5, 5};
+    Piece queen = game->board.board[from.x][from.y];
+    startMoveAnimation(game, queen, from, to);
+
+    SDL_Rect square = getSquareRect(&game->layout, 4, 4);
+    emitParticles(square.x + square.w / 2.0f, square.y + square.h / 2.0f, COLOR_HIGHLIGHT,
+                  PARTICLE_CAPACITY, 300.0f * game->layout.scale);
+}
+
+static const BenchScene scenes[] = {
+    {"menu", setupMenu, true, true},
+    {"tabuleiro", setupBoard, false, true},
+    {"selecao", setupSelection, false, true},
+    {"busca", setupSearch, false, true},
+    {"efeitos", setupEffects, false, false},
+};
+
+static void resetGame(ChessGame* game) {
+    memset(&game->board, 0, sizeof(game->board));
+    memset(&game->visualizer, 0, sizeof(game->visualizer));
+    memset(game->animations, 0, sizeof(game->animations));
+    clearParticles();
+    invalidateMoveOverlay(game);
+    game->board.isSelected = false;
+    game->showMoves = false;
+    game->routeLength = -1;
+    game->difficulty = 1;
+    game->score = 0;
+}
+
+static void renderFrame(ChessGame* game, Menu* menu, bool showMenu) {
+    SDL_SetRenderDrawColor(game->renderer, 30, 30, 30, 255);
+    SDL_RenderClear(game->renderer);
+
+    if (showMenu) {
+        drawMenu(game, menu);
+    } else {
+        updateAnimations(game);
+        updateParticles();
+        drawBoard(game);
+        drawVisualizer(game);
+        drawUI(game);
+    }
+    SDL_RenderPresent(game->renderer);
+}
+
+// === Quadros em PPM (P6) ===
+
+static bool writePPM(SDL_Surface* surface, const char* path) {
+    FILE* file = fopen(path, "wb");
+    Uint8* line = (Uint8*)malloc((size_t)surface->w * 3);
+    if (!file || !line) {
+        if (file) fclose(file);
+        free(line);
+        return false;
+    }
+
+    fprintf(file, "P6\n%d %d\n255\n", surface->w, surface->h);
+    for (int y = 0; y < surface->h; y++) {
+        const Uint8* row = (const Uint8*)surface->pixels + (size_t)y * surface->pitch;
+        for (int x = 0; x < surface->w; x++) {
+            memcpy(line + x * 3, row + x * 4, 3);   // RGBA32: R, G, B na ordem dos bytes
+        }
+        fwrite(line, 3, (size_t)surface->w, file);
+    }
+    free(line);
+    return fclose(file) == 0;
+}
+
+// Compara o quadro com a referência; retorna o número de pixels diferentes ou -1
+static long comparePPM(SDL_Surface* surface, const char* path, int tolerance) {
+    FILE* file = fopen(path, "rb");
+    if (!file) {
+        return -1;
+    }
+
+    int width, height, maxValue;
+    if (fscanf(file, "P6 %d %d %d", &width, &height, &maxValue) != 3 ||
+        width != surface->w || height != surface->h || maxValue != 255) {
+        fclose(file);
+        return -1;
+    }
+    fgetc(file);    // Um espaço separa o cabeçalho dos pixels
+
+    long different = 0;
+    Uint8* expected = (Uint8*)malloc((size_t)width * 3);
+    for (int y = 0; y < height && expected; y++) {
+        if (fread(expected, 3, (size_t)width, file) != (size_t)width) {
+            different = -1;
+            break;
+        }
+        const Uint8* row = (const Uint8*)surface->pixels + (size_t)y * surface->pitch;
+        for (int x = 0; x < width; x++) {
+            for (int c = 0; c < 3; c++) {
+                if (abs(row[x * 4 + c] - expected[x * 3 + c]) > tolerance) {
+                    different++;
+                    break;
+                }
+            }
+        }
+    }
+
+    free(expected);
+    fclose(file);
+    return different;
+}
+
+static void printUsage(const char* program) {
+    printf("Uso: %s [--frames N] [--size LxA] [--dump DIR] [--compare DIR] [--tolerance T]\n", program);
+}
+
+int main(int argc, char* argv[]) {
+    int frames = BENCH_DEFAULT_FRAMES;
+    int width = WINDOW_WIDTH, height = WINDOW_HEIGHT;
+    int tolerance = 0;
+    const char* dumpDir = NULL;
+    const char* compareDir = NULL;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--frames") == 0 && i + 1 < argc) {
+            frames = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--size") == 0 && i + 1 < argc) {
+            if (sscanf(argv[++i], "%dx%d", &width, &height) != 2) {
+                printUsage(argv[0]);
+                return 1;
+            }
+        } else if (strcmp(argv[i], "--dump") == 0 && i + 1 < argc) {
+            dumpDir = argv[++i];
+        } else if (strcmp(argv[i], "--compare") == 0 && i + 1 < argc) {
+            compareDir = argv[++i];
+        } else if (strcmp(argv[i], "--tolerance") == 0 && i + 1 < argc) {
+            tolerance = atoi(argv[++i]);
+        } else {
+            printUsage(argv[0]);
+            return 1;
+        }
+    }
+    if (frames < 1 || width < 1 || height < 1) {
+        printUsage(argv[0]);
+        return 1;
+    }
+
+    // Sem tela: driver de vídeo "dummy", a não ser que já venha do ambiente
+    SDL_setenv("SDL_VIDEODRIVER", "dummy", 0);
+    if (SDL_Init(SDL_INIT_VIDEO) < 0 || TTF_Init() < 0) {
+        printf("Erro ao inicializar SDL: %s\n", SDL_GetError());
+        return 1;
+    }
+
+    ChessGame game;
+    memset(&game, 0, sizeof(game));
+
+    SDL_Surface* surface = SDL_CreateRGBSurfaceWithFormat(0, width, height, 32, SDL_PIXELFORMAT_RGBA32);
+    game.renderer = surface ? SDL_CreateSoftwareRenderer(surface) : NULL;
+    if (!game.renderer) {
+        printf("Erro ao criar renderer por software: %s\n", SDL_GetError());
+        return 1;
+    }
+
+    computeLayout(&game.layout, width, height);
+    openAssetPack(ASSET_PACK_PATH);
+    game.fontPath = "assets/fonts/arial.ttf";
+    if (!openFonts(&game)) {
+        printf("Aviso: fonte não encontrada, usando a fonte embutida\n");
+    }
+    strcpy(game.playerName, "Jogador");
+
+    Menu menu = {.selectedOption = 1, .totalOptions = 4, .isActive = true};
+    strcpy(menu.options[0], "Novato - Torre, Bispo, Rainha");
+    strcpy(menu.options[1], "Aventureiro - Cavalo");
+    strcpy(menu.options[2], "Mestre - Algoritmo Recursivo");
+    strcpy(menu.options[3], "Sair");
+
+    printf("Renderização sem janela: %dx%d, %d quadros por cena\n\n", width, height, frames);
+    printf("%-12s %10s %12s %10s\n", "Cena", "FPS", "ms/quadro", "Chamadas");
+
+    int failures = 0;
+    for (size_t s = 0; s < sizeof(scenes) / sizeof(scenes[0]); s++) {
+        const BenchScene* scene = &scenes[s];
+        resetGame(&game);
+        scene->setup(&game);
+
+        // Um quadro de aquecimento cria atlas, camada do tabuleiro e textos
+        renderFrame(&game, &menu, scene->menu);
+
+        drawCalls = 0;
+        Uint64 start = SDL_GetPerformanceCounter();
+        for (int f = 0; f < frames; f++) {
+            renderFrame(&game, &menu, scene->menu);
+        }
+        double seconds = (double)(SDL_GetPerformanceCounter() - start) / (double)SDL_GetPerformanceFrequency();
+
+        printf("%-12s %10.1f %12.3f %10.1f\n", scene->name,
+               seconds > 0 ? frames / seconds : 0.0, seconds * 1000.0 / frames,
+               (double)drawCalls / frames);
+
+        char path[BENCH_PATH_LENGTH];
+        if (dumpDir) {
+            snprintf(path, sizeof(path), "%s/%s.ppm", dumpDir, scene->name);
+            if (!writePPM(surface, path)) {
+                printf("  Erro ao gravar %s\n", path);
+                failures++;
+            }
+        }
+        if (compareDir && scene->deterministic) {
+            snprintf(path, sizeof(path), "%s/%s.ppm", compareDir, scene->name);
+            long different = comparePPM(surface, path, tolerance);
+            if (different != 0) {
+                printf("  Diferente da referência %s (%ld pixels)\n", path, different);
+                failures++;
+            }
+        }
+    }
+
+    clearTextCache();
+    destroyFallbackFont();
+    destroyPieceAtlas(&game);
+    destroyBoardLayer(&game);
+    if (game.font) TTF_CloseFont(game.font);
+    if (game.bigFont) TTF_CloseFont(game.bigFont);
+    SDL_DestroyRenderer(game.renderer);
+    SDL_FreeSurface(surface);
+    closeAssetPack();
+    TTF_Quit();
+    SDL_Quit();
+
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,315 @@
+#include "chess_engine.h"
+
+// Regras completas do jogo: ataques, xeque, lances legais e fim de partida
+// Os lances pseudo-legais continuam vindo dos geradores em pieces.c;
+// aqui só filtramos os que deixam o próprio rei em xeque.
+
+static const int knightOffsets[8][2] = {
+    {2, 1}, {2, -1}, {-2, 1}, {-2, -1},
+    {1, 2}, {1, -2}, {-1, 2}, {-1, -2}
+};
+
+static const int kingOffsets[8][2] = {
+    {0, 1}, {0, -1}, {1, 0}, {-1, 0},
+    {1, 1}, {1, -1}, {-1, 1}, {-1, -1}
+};
+
+static bool hasPiece(ChessBoard* board, int x, int y, PieceType type, PieceColor color) {
+    if (x < 0 || x >= BOARD_SIZE || y < 0 || y >= BOARD_SIZE) return false;
+    Piece* piece = &board->board[x][y];
+    return piece->type == type && piece->color == color;
+}
+
+// Percorre um raio até a primeira peça e verifica se ela ataca nessa direção
+static bool isRayAttacked(ChessBoard* board, Position pos, int dx, int dy,
+                          PieceType slider, PieceColor attacker) {
+    int x = pos.x + dx;
+    int y = pos.y + dy;
+
+    while (x >= 0 && x < BOARD_SIZE && y >= 0 && y < BOARD_SIZE) {
+        Piece* piece = &board->board[x][y];
+        if (piece->type != PIECE_NONE) {
+            return piece->color == attacker &&
+                   (piece->type == slider || piece->type == PIECE_QUEEN);
+        }
+        x += dx;
+        y += dy;
+    }
+    return false;
+}
+
+bool isSquareAttacked(ChessBoard* board, Position pos, PieceColor attacker) {
+    // Peões brancos andam para y menor, então atacam a partir de y + 1
+    int pawnRow = (attacker == COLOR_WHITE_PIECE) ? pos.y + 1 : pos.y - 1;
+    if (hasPiece(board, pos.x - 1, pawnRow, PIECE_PAWN, attacker) ||
+        hasPiece(board, pos.x + 1, pawnRow, PIECE_PAWN, attacker)) {
+        return true;
+    }
+
+    for (int i = 0; i < 8; i++) {
+        if (hasPiece(board, pos.x + knightOffsets[i][0], pos.y + knightOffsets[i][1],
+                     PIECE_KNIGHT, attacker)) {
+            return true;
+        }
+        if (hasPiece(board, pos.x + kingOffsets[i][0], pos.y + kingOffsets[i][1],
+                     PIECE_KING, attacker)) {
+            return true;
+        }
+    }
+
+    return isRayAttacked(board, pos, 1, 0, PIECE_ROOK, attacker) ||
+           isRayAttacked(board, pos, -1, 0, PIECE_ROOK, attacker) ||
+           isRayAttacked(board, pos, 0, 1, PIECE_ROOK, attacker) ||
+           isRayAttacked(board, pos, 0, -1, PIECE_ROOK, attacker) ||
+           isRayAttacked(board, pos, 1, 1, PIECE_BISHOP, attacker) ||
+           isRayAttacked(board, pos, 1, -1, PIECE_BISHOP, attacker) ||
+           isRayAttacked(board, pos, -1, 1, PIECE_BISHOP, attacker) ||
+           isRayAttacked(board, pos, -1, -1, PIECE_BISHOP, attacker);
+}
+
+Position findKing(ChessBoard* board, PieceColor color) {
+    for (int x = 0; x < BOARD_SIZE; x++) {
+        for (int y = 0; y < BOARD_SIZE; y++) {
+            if (hasPiece(board, x, y, PIECE_KING, color)) {
+                Position pos = {x, y};
+                return pos;
+            }
+        }
+    }
+    Position none = {-1, -1};
+    return none;
+}
+
+bool isKingInCheck(ChessBoard* board, PieceColor color) {
+    Position king = findKing(board, color);
+    if (!isPositionValid(king)) {
+        return false;
+    }
+    return isSquareAttacked(board, king, !color);
+}
+
+static void clearSquare(Piece* piece) {
+    piece->type = PIECE_NONE;
+    piece->color = COLOR_WHITE_PIECE;
+    piece->hasMoved = false;
+}
+
+// Roque: o rei anda duas colunas e a torre do canto passa para o outro lado dele
+static void moveCastlingRook(ChessBoard* board, Move move, bool undoing) {
+    int direction = move.to.x > move.from.x ? 1 : -1;
+    int cornerX = direction > 0 ? BOARD_SIZE - 1 : 0;
+    int rookX = move.from.x + direction;
+    Piece* corner = &board->board[cornerX][move.from.y];
+    Piece* beside = &board->board[rookX][move.from.y];
+
+    if (undoing) {
+        *corner = *beside;
+        corner->pos.x = cornerX;
+        corner->hasMoved = false;
+        clearSquare(beside);
+    } else {
+        *beside = *corner;
+        beside->pos.x = rookX;
+        beside->hasMoved = true;
+        clearSquare(corner);
+    }
+}
+
+void applyMove(ChessBoard* board, Move move, MoveUndo* undo) {
+    Piece* fromPiece = &board->board[move.from.x][move.from.y];
+    Piece* toPiece = &board->board[move.to.x][move.to.y];
+    bool pawn = fromPiece->type == PIECE_PAWN;
+
+    undo->move = move;
+    undo->moved = *fromPiece;
+    undo->captured = *toPiece;
+    undo->capturedAt = move.to;
+    undo->currentPlayer = board->currentPlayer;
+    undo->moveCount = board->moveCount;
+    undo->enPassant = board->enPassant;
+    undo->halfmoveClock = board->halfmoveClock;
+
+    // En passant: peão na diagonal para casa vazia captura o peão ao lado
+    if (pawn && move.from.x != move.to.x && toPiece->type == PIECE_NONE) {
+        Piece* passed = &board->board[move.to.x][move.from.y];
+        undo->captured = *passed;
+        undo->capturedAt.x = move.to.x;
+        undo->capturedAt.y = move.from.y;
+        clearSquare(passed);
+    }
+    if (fromPiece->type == PIECE_KING && abs(move.to.x - move.from.x) == 2) {
+        moveCastlingRook(board, move, false);
+    }
+
+    *toPiece = *fromPiece;
+    toPiece->pos = move.to;
+    toPiece->hasMoved = true;
+    if (move.promotion != PIECE_NONE) {
+        toPiece->type = move.promotion;
+    }
+    clearSquare(fromPiece);
+
+    board->enPassant.x = -1;
+    board->enPassant.y = -1;
+    if (pawn && abs(move.to.y - move.from.y) == 2) {
+        board->enPassant.x = move.from.x;
+        board->enPassant.y = (move.from.y + move.to.y) / 2;
+    }
+    board->halfmoveClock = (pawn || undo->captured.type != PIECE_NONE) ? 0 : board->halfmoveClock + 1;
+    board->moveCount++;
+    board->currentPlayer = !board->currentPlayer;
+}
+
+void undoMove(ChessBoard* board, const MoveUndo* undo) {
+    Move move = undo->move;
+
+    board->board[move.from.x][move.from.y] = undo->moved;
+    if (undo->capturedAt.x == move.to.x && undo->capturedAt.y == move.to.y) {
+        board->board[move.to.x][move.to.y] = undo->captured;
+    } else {
+        clearSquare(&board->board[move.to.x][move.to.y]);
+        board->board[undo->capturedAt.x][undo->capturedAt.y] = undo->captured;
+    }
+    if (undo->moved.type == PIECE_KING && abs(move.to.x - move.from.x) == 2) {
+        moveCastlingRook(board, move, true);
+    }
+
+    board->currentPlayer = undo->currentPlayer;
+    board->moveCount = undo->moveCount;
+    board->enPassant = undo->enPassant;
+    board->halfmoveClock = undo->halfmoveClock;
+}
+
+// Lances legais do jogador da vez; promoções geram as quatro peças possíveis
+int generateLegalMoves(ChessBoard* board, Move moves[]) {
+    PieceType promotions[4] = {PIECE_QUEEN, PIECE_ROOK, PIECE_BISHOP, PIECE_KNIGHT};
+    PieceColor side = board->currentPlayer;
+    int count = 0;
+
+    for (int x = 0; x < BOARD_SIZE; x++) {
+        for (int y = 0; y < BOARD_SIZE; y++) {
+            Piece* piece = &board->board[x][y];
+            if (piece->type == PIECE_NONE || piece->color != side) continue;
+
+            Position from = {x, y};
+            Position targets[64];
+            int targetCount = 0;
+            getPossibleMoves(board, from, targets, &targetCount);
+
+            bool promotes = piece->type == PIECE_PAWN;
+            for (int i = 0; i < targetCount; i++) {
+                // O rei nunca é capturado: lances que o alcançam não são legais
+                if (board->board[targets[i].x][targets[i].y].type == PIECE_KING) continue;
+
+                Move move = {from, targets[i], PIECE_NONE};
+                MoveUndo undo;
+                applyMove(board, move, &undo);
+                bool legal = !isKingInCheck(board, side);
+                undoMove(board, &undo);
+                if (!legal) continue;
+
+                if (promotes && (targets[i].y == 0 || targets[i].y == BOARD_SIZE - 1)) {
+                    for (int p = 0; p < 4; p++) {
+                        move.promotion = promotions[p];
+                        moves[count++] = move;
+                    }
+                } else {
+                    moves[count++] = move;
+                }
+            }
+        }
+    }
+
+    return count;
+}
+
+// O lance está entre os legais do jogador da vez (inclusive a peça da promoção)
+bool isLegalMove(ChessBoard* board, Move move) {
+    Move legal[MAX_LEGAL_MOVES];
+    int count = generateLegalMoves(board, legal);
+    for (int i = 0; i < count; i++) {
+        if (legal[i].from.x == move.from.x && legal[i].from.y == move.from.y &&
+            legal[i].to.x == move.to.x && legal[i].to.y == move.to.y &&
+            legal[i].promotion == move.promotion) {
+            return true;
+        }
+    }
+    return false;
+}
+
+GameStatus getGameStatus(ChessBoard* board) {
+    Move moves[MAX_LEGAL_MOVES];
+    if (generateLegalMoves(board, moves) > 0) {
+        return GAME_IN_PROGRESS;
+    }
+    return isKingInCheck(board, board->currentPlayer) ? GAME_CHECKMATE : GAME_STALEMATE;
+}
+
+// Chave pseudoaleatória para (peça, cor, casa) sem tabela global (splitmix64)
+static Uint64 hashKey(Uint64 index) {
+    Uint64 z = (index + 1) * 0x9E3779B97F4A7C15ULL;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+static bool canStillCastle(ChessBoard* board, PieceColor color, int rookX) {
+    int homeRow = (color == COLOR_WHITE_PIECE) ? BOARD_SIZE - 1 : 0;
+    Piece* king = &board->board[4][homeRow];
+    Piece* rook = &board->board[rookX][homeRow];
+    return king->type == PIECE_KING && king->color == color && !king->hasMoved &&
+           rook->type == PIECE_ROOK && rook->color == color && !rook->hasMoved;
+}
+
+// O en passant só muda a posição se o lado da vez puder capturar de fato:
+// depois de um avanço duplo sem peão ao lado (ou com o peão cravado) a
+// posição é a mesma de quando não houve avanço duplo
+static bool canCaptureEnPassant(ChessBoard* board) {
+    Position target = board->enPassant;
+    PieceColor side = board->currentPlayer;
+    int direction = (side == COLOR_WHITE_PIECE) ? -1 : 1;
+    Position pushed = {target.x, target.y - direction};
+    Piece* passed = getPieceAt(board, pushed);
+    if (!isPositionEmpty(board, target) || !passed || passed->type != PIECE_PAWN || passed->color == side) {
+        return false;       // Casa de FEN sem o avanço duplo correspondente
+    }
+
+    for (int dx = -1; dx <= 1; dx += 2) {
+        Position from = {target.x + dx, target.y - direction};
+        Piece* pawn = getPieceAt(board, from);
+        if (!pawn || pawn->type != PIECE_PAWN || pawn->color != side) continue;
+
+        Move move = {from, target, PIECE_NONE};
+        MoveUndo undo;
+        applyMove(board, move, &undo);
+        bool legal = !isKingInCheck(board, side);
+        undoMove(board, &undo);
+        if (legal) return true;
+    }
+    return false;
+}
+
+// Hash da posição no estilo Zobrist: peças, lado da vez, direitos de roque e
+// coluna do en passant capturável (posições só se repetem se os quatro coincidirem)
+Uint64 computeBoardHash(ChessBoard* board) {
+    Uint64 hash = board->currentPlayer == COLOR_BLACK_PIECE ? hashKey(1000) : 0;
+
+    if (isPositionValid(board->enPassant) && canCaptureEnPassant(board)) {
+        hash ^= hashKey((Uint64)(1001 + board->enPassant.x));
+    }
+    for (int color = 0; color < 2; color++) {
+        if (canStillCastle(board, (PieceColor)color, BOARD_SIZE - 1)) hash ^= hashKey((Uint64)(1010 + color * 2));
+        if (canStillCastle(board, (PieceColor)color, 0)) hash ^= hashKey((Uint64)(1011 + color * 2));
+    }
+
+    for (int x = 0; x < BOARD_SIZE; x++) {
+        for (int y = 0; y < BOARD_SIZE; y++) {
+            Piece* piece = &board->board[x][y];
+            if (piece->type == PIECE_NONE) continue;
+
+            int square = y * BOARD_SIZE + x;
+            hash ^= hashKey((Uint64)((piece->type * 2 + piece->color) * 64 + square));
+        }
+    }
+    return hash;
+}
@@ -0,0 +1,240 @@
+#ifndef _WIN32
+#define _POSIX_C_SOURCE 200809L     // mkdir com -std=c99
+#endif
+
+#include "chess_engine.h"
+
+#ifdef _WIN32
+#include <direct.h>
+#else
+#include <sys/stat.h>
+#endif
+
+// Partidas salvas
+// O arquivo binário é a própria estrutura SaveFile, gravada e lida com uma
+// única chamada: campos de largura fixa em ordem de alinhamento (sem
+// preenchimento do compilador), na ordem de bytes da máquina. A marca
+// byteOrder e o tamanho total recusam arquivos de outra arquitetura ou de
+// outro MAX_MOVES. Casas: tipo | cor << 3 | movida << 4; lances no formato
+// de 16 bits dos problemas (encodeMove). A posição final gravada confere a
+// reprodução dos lances na leitura; os pontos saem do número de lances.
+
+#define SAVE_BYTE_ORDER 0x0102
+#define SAVE_NO_SQUARE 0xFF
+
+typedef struct {
+    char magic[4];                  // "MCSV"
+    Uint16 version;
+    Uint16 byteOrder;
+    Uint32 size;                    // sizeof(SaveFile)
+    Uint16 moveTotal;
+    Uint16 moveCount;
+    Uint16 halfmoveClock;
+    Uint16 startMoveCount;
+    Uint16 startHalfmoveClock;
+    Uint8 difficulty;
+    Uint8 currentPlayer;
+    Uint8 startPlayer;
+    Uint8 enPassant;                // y * 8 + x ou SAVE_NO_SQUARE
+    Uint8 startEnPassant;
+    Uint8 reserved;
+    Uint8 squares[BOARD_SIZE * BOARD_SIZE];
+    Uint8 startSquares[BOARD_SIZE * BOARD_SIZE];
+    char playerName[52];            // 50 de ChessGame + 2 para alinhar
+    Uint16 moves[MAX_MOVES];
+} SaveFile;
+
+// A estrutura precisa ter exatamente o tamanho da soma dos campos
+typedef char saveFileHasNoPadding[sizeof(SaveFile) == 208 + 2 * MAX_MOVES ? 1 : -1];
+
+static void packSquares(ChessBoard* board, Uint8 squares[BOARD_SIZE * BOARD_SIZE]) {
+    for (int square = 0; square < BOARD_SIZE * BOARD_SIZE; square++) {
+        Piece* piece = &board->board[square % BOARD_SIZE][square / BOARD_SIZE];
+        squares[square] = piece->type == PIECE_NONE ? 0 :
+            (Uint8)(piece->type | (piece->color << 3) | (piece->hasMoved << 4));
+    }
+}
+
+static bool unpackSquares(ChessBoard* board, const Uint8 squares[BOARD_SIZE * BOARD_SIZE]) {
+    clearBoard(board);
+    for (int square = 0; square < BOARD_SIZE * BOARD_SIZE; square++) {
+        Piece* piece = &board->board[square % BOARD_SIZE][square / BOARD_SIZE];
+        if ((squares[square] & 7) > PIECE_KING) return false;
+        piece->type = (PieceType)(squares[square] & 7);
+        piece->color = (PieceColor)((squares[square] >> 3) & 1);
+        piece->hasMoved = (squares[square] >> 4) & 1;
+    }
+    return true;
+}
+
+static Uint8 packSquare(Position pos) {
+    return isPositionValid(pos) ? (Uint8)(pos.y * BOARD_SIZE + pos.x) : SAVE_NO_SQUARE;
+}
+
+static Position unpackSquare(Uint8 square) {
+    Position pos = {-1, -1};
+    if (square < BOARD_SIZE * BOARD_SIZE) {
+        pos.x = square % BOARD_SIZE;
+        pos.y = square / BOARD_SIZE;
+    }
+    return pos;
+}
+
+static void ensureSaveDirectory(void) {
+#ifdef _WIN32
+    _mkdir(SAVE_FILE_PATH);
+#else
+    mkdir(SAVE_FILE_PATH, 0755);
+#endif
+}
+
+bool saveGame(ChessGame* game, const char* path) {
+    static SaveFile save;    // ~2 KB: fora da pilha
+    ChessBoard* board = &game->board;
+    ChessBoard* start = &game->record.start;
+
+    memset(&save, 0, sizeof(save));
+    memcpy(save.magic, "MCSV", 4);
+    save.version = SAVE_FILE_VERSION;
+    save.byteOrder = SAVE_BYTE_ORDER;
+    save.size = (Uint32)sizeof(save);
+    save.moveTotal = (Uint16)game->record.count;
+    save.moveCount = (Uint16)board->moveCount;
+    save.halfmoveClock = (Uint16)board->halfmoveClock;
+    save.startMoveCount = (Uint16)start->moveCount;
+    save.startHalfmoveClock = (Uint16)start->halfmoveClock;
+    save.difficulty = (Uint8)game->difficulty;
+    save.currentPlayer = (Uint8)board->currentPlayer;
+    save.startPlayer = (Uint8)start->currentPlayer;
+    save.enPassant = packSquare(board->enPassant);
+    save.startEnPassant = packSquare(start->enPassant);
+    packSquares(board, save.squares);
+    packSquares(start, save.startSquares);
+    strncpy(save.playerName, game->playerName, sizeof(save.playerName) - 1);
+    for (int i = 0; i < game->record.count; i++) {
+        save.moves[i] = (Uint16)encodeMove(game->record.moves[i]);
+    }
+
+    ensureSaveDirectory();
+    FILE* file = fopen(path, "wb");
+    if (!file) {
+        LOG_ERROR("Erro ao criar %s", path);
+        return false;
+    }
+    bool ok = fwrite(&save, sizeof(save), 1, file) == 1;
+    ok = fclose(file) == 0 && ok;
+    return ok;
+}
+
+bool loadGame(ChessGame* game, const char* path) {
+    static SaveFile save;
+    FILE* file = fopen(path, "rb");
+    if (!file) {
+        return false;
+    }
+    bool ok = fread(&save, sizeof(save), 1, file) == 1;
+    fclose(file);
+
+    if (!ok || memcmp(save.magic, "MCSV", 4) != 0 || save.version != SAVE_FILE_VERSION ||
+        save.byteOrder != SAVE_BYTE_ORDER || save.size != sizeof(save) ||
+        save.moveTotal > MAX_MOVES || save.currentPlayer > 1 || save.startPlayer > 1) {
+        LOG_WARN("Arquivo de partida inválido: %s", path);
+        return false;
+    }
+
+    // Montar tudo à parte: um arquivo corrompido não estraga a partida atual.
+    // A posição atual é refeita pelos lances e precisa bater com a gravada.
+    ChessBoard board, start;
+    if (!unpackSquares(&board, save.squares) || !unpackSquares(&start, save.startSquares)) {
+        LOG_WARN("Arquivo de partida inválido: %s", path);
+        return false;
+    }
+    start.currentPlayer = save.startPlayer;
+    start.moveCount = save.startMoveCount;
+    start.halfmoveClock = save.startHalfmoveClock;
+    start.enPassant = unpackSquare(save.startEnPassant);
+
+    board = start;
+    for (int i = 0; i < save.moveTotal; i++) {
+        Move move = decodeMove(save.moves[i]);
+        if (!isLegalMove(&board, move)) {
+            LOG_WARN("Lance %d ilegal em %s", i + 1, path);
+            return false;
+        }
+        MoveUndo undo;
+        applyMove(&board, move, &undo);
+    }
+    Uint8 replayed[BOARD_SIZE * BOARD_SIZE];
+    packSquares(&board, replayed);
+    if (memcmp(replayed, save.squares, sizeof(replayed)) != 0 ||
+        board.currentPlayer != save.currentPlayer || board.moveCount != save.moveCount ||
+        board.halfmoveClock != save.halfmoveClock || packSquare(board.enPassant) != save.enPassant) {
+        LOG_WARN("Lances não reproduzem a posição gravada: %s", path);
+        return false;
+    }
+
+    game->record.start = start;
+    game->record.count = save.moveTotal;
+    for (int i = 0; i < save.moveTotal; i++) {
+        game->record.moves[i] = decodeMove(save.moves[i]);
+    }
+    replayGameRecord(game);
+    game->difficulty = save.difficulty;
+    memcpy(game->playerName, save.playerName, sizeof(game->playerName));
+    game->playerName[sizeof(game->playerName) - 1] = '\0';
+    return true;
+}
+
+bool exportPGN(ChessGame* game, const char* pgnPath, const char* fenPath) {
+    ensureSaveDirectory();
+
+    FILE* file = fopen(pgnPath, "w");
+    if (!file) {
+        LOG_ERROR("Erro ao criar %s", pgnPath);
+        return false;
+    }
+    bool ok = writePGN(file, &game->record.start, game->record.moves, game->record.count,
+                       game->playerName);
+    ok = fclose(file) == 0 && ok;
+
+    char fen[FEN_MAX_LENGTH];
+    boardToFEN(&game->board, fen);
+    LOG_INFO("FEN: %s", fen);
+    file = fopen(fenPath, "w");
+    if (file) {
+        fprintf(file, "%s\n", fen);
+        ok = fclose(file) == 0 && ok;
+    }
+    return ok;
+}
+
+// Importa a primeira partida do arquivo; sem PGN válido tenta ler uma FEN
+bool importPGN(ChessGame* game, const char* path) {
+    FILE* file = fopen(path, "rb");
+    if (!file) {
+        LOG_WARN("Nada para importar em %s", path);
+        return false;
+    }
+
+    static char text[64 * 1024];
+    size_t length = fread(text, 1, sizeof(text) - 1, file);
+    fclose(file);
+    text[length] = '\0';
+
+    static Move moves[MAX_MOVES];
+    ChessBoard start;
+    int count = readPGN(text, length, &start, moves, MAX_MOVES);
+    if (count < 0) {
+        if (!loadFEN(&start, text)) {
+            LOG_ERROR("Partida inválida, nada importado: %s", path);
+            return false;
+        }
+        count = 0;
+    }
+
+    game->record.start = start;
+    game->record.count = count;
+    memcpy(game->record.moves, moves, (size_t)count * sizeof(Move));
+    replayGameRecord(game);
+    return true;
+}
@@ -0,0 +1,495 @@
+#include "chess_engine.h"
+
+// Busca alfa-beta (frontend UCI)
+// Negamax com aprofundamento iterativo, janela nula (PVS), extensão de
+// xeque, busca de quietude nas capturas e tabela de transposição. Com mais
+// de uma thread, os ajudantes rodam a mesma busca no pool de threads
+// começando em profundidades alternadas (Lazy SMP) e só se comunicam pela
+// tabela. A thread principal mede o tempo e conta os nós de todas.
+
+#define SEARCH_INFINITY 32000
+#define SEARCH_NODE_BLOCK 1024          // Nós entre verificações de tempo e parada
+#define TABLE_EXACT 1
+#define TABLE_LOWER 2                   // Corte beta: o valor é no mínimo score
+#define TABLE_UPPER 3                   // Falhou baixo: o valor é no máximo score
+
+// Entrada sem trava: check = chave ^ data, então uma escrita rasgada por
+// outra thread simplesmente não confere
+typedef struct {
+    Uint64 check;
+    Uint64 data;        // score 16 | lance 16 | profundidade 8 | tipo 8 | idade 8
+} TableEntry;
+
+typedef struct {
+    ChessBoard board;
+    Uint64 path[MAX_MOVES + SEARCH_MAX_PLY + 1];    // Hashes da partida e do caminho atual
+    int pathLength;
+    int pendingNodes;       // Nós ainda não somados em nodeBlocks
+    bool stopped;
+    int id;
+    int depthLimit;
+    int completedDepth;
+    int bestScore;
+    Move bestMove;
+} SearchThread;
+
+static TableEntry* table;
+static Uint64 tableMask;
+static Uint8 tableAge;
+
+static SearchThread searchThreads[SEARCH_MAX_THREADS];
+static int threadCount = 1;
+static ThreadPool* helperPool;
+
+static SDL_atomic_t stopFlag;
+static SDL_atomic_t nodeBlocks;
+static SDL_atomic_t deadlineStart;      // SDL_GetTicks() do início do prazo
+static SDL_atomic_t deadlineBudget;     // ms do prazo (0 = sem prazo)
+static long long nodeLimit;
+static Uint32 searchStart;
+
+static const int pieceValues[] = {0, 100, 500, 320, 330, 900, 0};
+
+// ---- Tabela de transposição ----
+
+bool resizeSearchTable(int megabytes) {
+    Uint64 entries = 1;
+    while (entries * 2 * sizeof(TableEntry) <= (Uint64)megabytes * 1024 * 1024) {
+        entries *= 2;
+    }
+    TableEntry* resized = (TableEntry*)calloc((size_t)entries, sizeof(TableEntry));
+    if (!resized) {
+        return false;
+    }
+    free(table);
+    table = resized;
+    tableMask = entries - 1;
+    return true;
+}
+
+void clearSearchTable(void) {
+    if (table) {
+        memset(table, 0, (size_t)(tableMask + 1) * sizeof(TableEntry));
+    }
+    tableAge = 0;
+}
+
+// Por mil das entradas da busca atual, pela amostra das 1000 primeiras
+int getSearchHashfull(void) {
+    if (!table) return 0;
+    int sample = tableMask + 1 < 1000 ? (int)(tableMask + 1) : 1000;
+    int used = 0;
+    for (int i = 0; i < sample; i++) {
+        if (table[i].data && (Uint8)(table[i].data >> 48) == tableAge) used++;
+    }
+    return used * 1000 / sample;
+}
+
+// Placares de mate são guardados relativos à posição, não à raiz
+static int scoreToTable(int score, int ply) {
+    if (score > SEARCH_MATE_SCORE - SEARCH_MAX_PLY) return score + ply;
+    if (score < -SEARCH_MATE_SCORE + SEARCH_MAX_PLY) return score - ply;
+    return score;
+}
+
+static int scoreFromTable(int score, int ply) {
+    if (score > SEARCH_MATE_SCORE - SEARCH_MAX_PLY) return score - ply;
+    if (score < -SEARCH_MATE_SCORE + SEARCH_MAX_PLY) return score + ply;
+    return score;
+}
+
+static bool probeTable(Uint64 key, Uint64* data) {
+    TableEntry* entry = &table[key & tableMask];
+    Uint64 value = entry->data;
+    if (value && (entry->check ^ value) == key) {
+        *data = value;
+        return true;
+    }
+    return false;
+}
+
+static void storeTable(Uint64 key, int depth, int score, int type, unsigned int move) {
+    TableEntry* entry = &table[key & tableMask];
+    Uint64 old = entry->data;
+    bool sameKey = (entry->check ^ old) == key;
+    // Substitui entradas de buscas anteriores ou mais rasas
+    if (old && !sameKey && (Uint8)(old >> 48) == tableAge && (int)((old >> 32) & 0xFF) > depth) {
+        return;
+    }
+    Uint64 data = (Uint64)(Uint16)score | ((Uint64)(move & 0xFFFF) << 16) |
+                  ((Uint64)(Uint8)depth << 32) | ((Uint64)type << 40) | ((Uint64)tableAge << 48);
+    entry->check = key ^ data;
+    entry->data = data;
+}
+
+// ---- Avaliação ----
+
+// Material e posição, do ponto de vista do lado da vez. Peões valem mais ao
+// avançar; cavalos e bispos, no centro.
+static int evaluate(ChessBoard* board) {
+    int score = 0;
+    for (int x = 0; x < BOARD_SIZE; x++) {
+        for (int y = 0; y < BOARD_SIZE; y++) {
+            Piece* piece = &board->board[x][y];
+            if (piece->type == PIECE_NONE) continue;
+
+            int value = pieceValues[piece->type];
+            int centerDistance = abs(2 * x - 7) + abs(2 * y - 7);     // 2 (centro) a 14 (canto)
+            int advance = piece->color == COLOR_WHITE_PIECE ? 6 - y : y - 1;
+            switch (piece->type) {
+                case PIECE_PAWN:
+                    value += advance * (x >= 2 && x <= 5 ? 8 : 4);
+                    break;
+                case PIECE_KNIGHT:
+                case PIECE_BISHOP:
+                    value += 20 - 3 * centerDistance;
+                    break;
+                case PIECE_QUEEN:
+                    value += 7 - centerDistance;
+                    break;
+                default:
+                    break;
+            }
+            score += piece->color == COLOR_WHITE_PIECE ? value : -value;
+        }
+    }
+    return board->currentPlayer == COLOR_WHITE_PIECE ? score : -score;
+}
+
+// ---- Controle da busca ----
+
+static long long totalNodes(void) {
+    return (long long)SDL_AtomicGet(&nodeBlocks) * SEARCH_NODE_BLOCK;
+}
+
+static bool deadlinePassed(double fraction) {
+    Uint32 budget = (Uint32)SDL_AtomicGet(&deadlineBudget);
+    if (budget == 0) return false;
+    Uint32 elapsed = SDL_GetTicks() - (Uint32)SDL_AtomicGet(&deadlineStart);
+    return elapsed >= budget * fraction;
+}
+
+// Conta um nó; a cada bloco soma no total e confere tempo, nós e parada
+static bool countNode(SearchThread* thread) {
+    if (++thread->pendingNodes >= SEARCH_NODE_BLOCK) {
+        thread->pendingNodes = 0;
+        SDL_AtomicAdd(&nodeBlocks, 1);
+        if (thread->id == 0 && (deadlinePassed(1.0) || (nodeLimit && totalNodes() >= nodeLimit))) {
+            SDL_AtomicSet(&stopFlag, 1);
+        }
+        thread->stopped = SDL_AtomicGet(&stopFlag) != 0;
+    }
+    return thread->stopped;
+}
+
+// Pede (ou cancela, antes de uma busca nova) a parada de todas as threads
+void setSearchStopped(bool stopped) {
+    SDL_AtomicSet(&stopFlag, stopped ? 1 : 0);
+}
+
+// Prazo a partir de agora (ponderhit ou início do lance); 0 = sem prazo
+void setSearchDeadline(Uint32 budgetMs) {
+    SDL_AtomicSet(&deadlineStart, (int)SDL_GetTicks());
+    SDL_AtomicSet(&deadlineBudget, (int)budgetMs);
+}
+
+// ---- Busca ----
+
+static void pushPath(SearchThread* thread) {
+    thread->path[thread->pathLength++] = computeBoardHash(&thread->board);
+}
+
+// Regra dos 50 lances ou posição repetida dentro da janela reversível
+static bool isDrawn(SearchThread* thread) {
+    int clock = thread->board.halfmoveClock;
+    if (clock >= 100) return true;
+    Uint64 current = thread->path[thread->pathLength - 1];
+    for (int back = 2; back <= clock && back < thread->pathLength; back += 2) {
+        if (thread->path[thread->pathLength - 1 - back] == current) return true;
+    }
+    return false;
+}
+
+static bool isCapture(ChessBoard* board, Move move) {
+    Piece* from = &board->board[move.from.x][move.from.y];
+    return board->board[move.to.x][move.to.y].type != PIECE_NONE ||
+           (from->type == PIECE_PAWN && move.from.x != move.to.x);
+}
+
+// Ordem: lance da tabela, capturas (vítima valiosa, atacante barato), promoções
+static void scoreMoves(ChessBoard* board, Move moves[], int scores[], int count, unsigned int tableMove) {
+    for (int i = 0; i < count; i++) {
+        int score = 0;
+        if (tableMove && encodeMove(moves[i]) == tableMove) {
+            score = 1000000;
+        } else if (isCapture(board, moves[i])) {
+            PieceType victim = board->board[moves[i].to.x][moves[i].to.y].type;
+            PieceType attacker = board->board[moves[i].from.x][moves[i].from.y].type;
+            score = 10000 + pieceValues[victim == PIECE_NONE ? PIECE_PAWN : victim] * 10 - pieceValues[attacker] / 10;
+        }
+        if (moves[i].promotion != PIECE_NONE) {
+            score += pieceValues[moves[i].promotion];
+        }
+        scores[i] = score;
+    }
+}
+
+// Seleção parcial: traz o melhor lance restante para a posição index
+static void pickMove(Move moves[], int scores[], int index, int count) {
+    int best = index;
+    for (int i = index + 1; i < count; i++) {
+        if (scores[i] > scores[best]) best = i;
+    }
+    Move move = moves[index];
+    int score = scores[index];
+    moves[index] = moves[best];
+    scores[index] = scores[best];
+    moves[best] = move;
+    scores[best] = score;
+}
+
+static int quiescence(SearchThread* thread, int alpha, int beta, int ply) {
+    ChessBoard* board = &thread->board;
+    if (countNode(thread)) return 0;
+
+    int standPat = evaluate(board);
+    if (standPat >= beta || ply >= SEARCH_MAX_PLY - 1) return standPat;
+    if (standPat > alpha) alpha = standPat;
+
+    Move moves[MAX_LEGAL_MOVES];
+    int scores[MAX_LEGAL_MOVES];
+    int total = generateLegalMoves(board, moves);
+    int count = 0;
+    for (int i = 0; i < total; i++) {
+        bool queening = moves[i].promotion == PIECE_QUEEN;
+        if ((isCapture(board, moves[i]) && (moves[i].promotion == PIECE_NONE || queening)) || queening) {
+            moves[count++] = moves[i];
+        }
+    }
+    scoreMoves(board, moves, scores, count, 0);
+
+    for (int i = 0; i < count; i++) {
+        pickMove(moves, scores, i, count);
+        MoveUndo undo;
+        applyMove(board, moves[i], &undo);
+        int score = -quiescence(thread, -beta, -alpha, ply + 1);
+        undoMove(board, &undo);
+        if (thread->stopped) return 0;
+        if (score >= beta) return score;
+        if (score > alpha) alpha = score;
+    }
+    return alpha;
+}
+
+static int negamax(SearchThread* thread, int alpha, int beta, int depth, int ply, Move* bestOut) {
+    ChessBoard* board = &thread->board;
+    bool pvNode = beta - alpha > 1;
+
+    if (ply > 0 && isDrawn(thread)) return 0;
+    bool inCheck = isKingInCheck(board, board->currentPlayer);
+    if (inCheck) depth++;
+    if (depth <= 0) return quiescence(thread, alpha, beta, ply);
+    if (countNode(thread)) return 0;
+    if (ply >= SEARCH_MAX_PLY - 1) return evaluate(board);
+
+    Uint64 key = thread->path[thread->pathLength - 1];
+    Uint64 data;
+    unsigned int tableMove = 0;
+    if (probeTable(key, &data)) {
+        tableMove = (unsigned int)((data >> 16) & 0xFFFF);
+        int storedDepth = (int)((data >> 32) & 0xFF);
+        int type = (int)((data >> 40) & 0xFF);
+        int score = scoreFromTable((Sint16)(data & 0xFFFF), ply);
+        if (!pvNode && ply > 0 && storedDepth >= depth &&
+            (type == TABLE_EXACT || (type == TABLE_LOWER && score >= beta) ||
+             (type == TABLE_UPPER && score <= alpha))) {
+            return score;
+        }
+    }
+
+    Move moves[MAX_LEGAL_MOVES];
+    int scores[MAX_LEGAL_MOVES];
+    int count = generateLegalMoves(board, moves);
+    if (count == 0) {
+        return inCheck ? -(SEARCH_MATE_SCORE - ply) : 0;
+    }
+    scoreMoves(board, moves, scores, count, tableMove);
+
+    int originalAlpha = alpha;
+    int bestScore = -SEARCH_INFINITY;
+    Move bestMove = moves[0];
+    for (int i = 0; i < count; i++) {
+        pickMove(moves, scores, i, count);
+        MoveUndo undo;
+        applyMove(board, moves[i], &undo);
+        pushPath(thread);
+
+        int score;
+        if (i == 0) {
+            score = -negamax(thread, -beta, -alpha, depth - 1, ply + 1, NULL);
+        } else {
+            // Janela nula: só pesquisa de novo se o lance parecer melhor
+            score = -negamax(thread, -alpha - 1, -alpha, depth - 1, ply + 1, NULL);
+            if (score > alpha && score < beta) {
+                score = -negamax(thread, -beta, -alpha, depth - 1, ply + 1, NULL);
+            }
+        }
+
+        thread->pathLength--;
+        undoMove(board, &undo);
+        if (thread->stopped) return 0;
+
+        if (score > bestScore) {
+            bestScore = score;
+            bestMove = moves[i];
+            if (score > alpha) {
+                alpha = score;
+                if (alpha >= beta) break;
+            }
+        }
+    }
+
+    int type = bestScore >= beta ? TABLE_LOWER : (bestScore > originalAlpha ? TABLE_EXACT : TABLE_UPPER);
+    storeTable(key, depth, scoreToTable(bestScore, ply), type, encodeMove(bestMove));
+    if (bestOut) *bestOut = bestMove;
+    return bestScore;
+}
+
+// Variação principal seguindo os lances da tabela (para as linhas info)
+static int collectPV(ChessBoard* root, Move first, Move pv[], int maxLength) {
+    ChessBoard board = *root;
+    int length = 0;
+    Move move = first;
+
+    while (length < maxLength) {
+        Move legal[MAX_LEGAL_MOVES];
+        int count = generateLegalMoves(&board, legal);
+        bool found = false;
+        for (int i = 0; i < count && !found; i++) {
+            found = encodeMove(legal[i]) == encodeMove(move);
+        }
+        if (!found) break;
+
+        MoveUndo undo;
+        applyMove(&board, move, &undo);
+        pv[length++] = move;
+
+        Uint64 data;
+        if (!probeTable(computeBoardHash(&board), &data) || !((data >> 16) & 0xFFFF)) break;
+        move = decodeMove((unsigned int)((data >> 16) & 0xFFFF));
+    }
+    return length;
+}
+
+// Aprofundamento iterativo; os ajudantes começam uma profundidade adiante
+// nas threads ímpares para não repetirem a principal
+static void runSearchThread(SearchThread* thread, SearchReport report, void* reportData) {
+    for (int depth = 1 + (thread->id & 1); depth <= thread->depthLimit; depth++) {
+        Move best = thread->bestMove;
+        int score = negamax(thread, -SEARCH_INFINITY, SEARCH_INFINITY, depth, 0, &best);
+        if (thread->stopped) break;
+
+        thread->completedDepth = depth;
+        thread->bestScore = score;
+        thread->bestMove = best;
+
+        if (thread->id != 0) continue;
+        if (report) {
+            SearchInfo info;
+            info.depth = depth;
+            info.score = score;
+            info.nodes = totalNodes() + thread->pendingNodes;
+            info.timeMs = SDL_GetTicks() - searchStart;
+            info.hashfull = getSearchHashfull();
+            info.pvLength = collectPV(&thread->board, best, info.pv, depth);
+            report(&info, reportData);
+        }
+        // Mate encontrado ou sem tempo para terminar a próxima iteração
+        if (abs(score) > SEARCH_MATE_SCORE - SEARCH_MAX_PLY || deadlinePassed(0.5)) break;
+    }
+}
+
+static void helperTask(ThreadPool* pool, int worker, void* data) {
+    (void)pool;
+    (void)worker;
+    runSearchThread((SearchThread*)data, NULL, NULL);
+}
+
+bool setSearchThreads(int count) {
+    if (count < 1) count = 1;
+    if (count > SEARCH_MAX_THREADS) count = SEARCH_MAX_THREADS;
+    if (helperPool) {
+        destroyThreadPool(helperPool);
+        helperPool = NULL;
+    }
+    threadCount = count;
+    if (count > 1) {
+        helperPool = createThreadPool(count - 1);
+        if (!helperPool) {
+            threadCount = 1;
+            return false;
+        }
+    }
+    return true;
+}
+
+// Busca o melhor lance. history traz os hashes das posições anteriores da
+// partida (para reconhecer repetições); o prazo vem de setSearchDeadline e
+// a parada pedida antes do início (setSearchStopped) também vale. Sem lances
+// legais o lance devolvido tem from.x = -1.
+Move searchBestMove(ChessBoard* board, const Uint64 history[], int historyCount,
+                    const SearchLimits* limits, SearchReport report, void* reportData, Move* ponder) {
+    Move none = {{-1, -1}, {-1, -1}, PIECE_NONE};
+    if (!table && !resizeSearchTable(SEARCH_DEFAULT_HASH_MB)) {
+        return none;
+    }
+    if (historyCount > MAX_MOVES) {
+        history += historyCount - MAX_MOVES;
+        historyCount = MAX_MOVES;
+    }
+
+    Move legal[MAX_LEGAL_MOVES];
+    int legalCount = generateLegalMoves(board, legal);
+    if (ponder) *ponder = none;
+    if (legalCount == 0) {
+        return none;
+    }
+
+    tableAge++;
+    searchStart = SDL_GetTicks();
+    nodeLimit = limits->nodes;
+    SDL_AtomicSet(&nodeBlocks, 0);
+
+    for (int i = 0; i < threadCount; i++) {
+        SearchThread* thread = &searchThreads[i];
+        thread->board = *board;
+        memcpy(thread->path, history, (size_t)historyCount * sizeof(Uint64));
+        thread->pathLength = historyCount;
+        pushPath(thread);
+        thread->pendingNodes = 0;
+        thread->stopped = SDL_AtomicGet(&stopFlag) != 0;
+        thread->id = i;
+        thread->depthLimit = limits->depth > 0 ? MIN(limits->depth, SEARCH_MAX_PLY - 1) : SEARCH_MAX_PLY - 1;
+        thread->completedDepth = 0;
+        thread->bestScore = 0;
+        thread->bestMove = legal[0];
+        if (i > 0) {
+            submitTask(helperPool, -1, helperTask, thread);
+        }
+    }
+
+    runSearchThread(&searchThreads[0], report, reportData);
+
+    // A principal terminou: parar os ajudantes e esperar por eles
+    SDL_AtomicSet(&stopFlag, 1);
+    if (helperPool) {
+        while (!waitThreadPool(helperPool, 100)) {}
+    }
+
+    Move best = searchThreads[0].bestMove;
+    if (ponder) {
+        Move pv[2];
+        if (collectPV(board, best, pv, 2) == 2) *ponder = pv[1];
+    }
+    return best;
+}
@@ -0,0 +1,218 @@
+#include "chess_engine.h"
+
+// Pool de threads com roubo de trabalho (work stealing)
+// Cada worker tem sua própria fila: o dono empilha e desempilha no fundo
+// (LIFO, bom para cache) e os workers ociosos roubam do topo das filas dos
+// outros (FIFO, pegando as tarefas mais antigas e normalmente maiores).
+
+typedef struct {
+    PoolTask function;
+    void* data;
+} PoolItem;
+
+typedef struct {
+    PoolItem items[POOL_QUEUE_SIZE];
+    int top;        // Ladrões retiram daqui
+    int bottom;     // O dono insere e retira daqui
+    SDL_mutex* lock;
+} WorkQueue;
+
+typedef struct {
+    ThreadPool* pool;
+    int index;
+} WorkerContext;
+
+struct ThreadPool {
+    SDL_Thread* threads[POOL_MAX_WORKERS];
+    WorkQueue queues[POOL_MAX_WORKERS];
+    WorkerContext contexts[POOL_MAX_WORKERS];
+    int workerCount;
+    SDL_atomic_t pending;       // Tarefas enfileiradas ou em execução
+    SDL_atomic_t nextQueue;     // Distribuição das tarefas externas
+    SDL_atomic_t stopping;
+    SDL_atomic_t steals;
+    SDL_mutex* sleepLock;
+    SDL_cond* wakeUp;
+    SDL_cond* allDone;
+};
+
+static bool popBottom(WorkQueue* queue, PoolItem* item) {
+    bool found = false;
+    SDL_LockMutex(queue->lock);
+    if (queue->bottom > queue->top) {
+        queue->bottom--;
+        *item = queue->items[queue->bottom % POOL_QUEUE_SIZE];
+        found = true;
+    }
+    SDL_UnlockMutex(queue->lock);
+    return found;
+}
+
+static bool stealTop(WorkQueue* queue, PoolItem* item) {
+    bool found = false;
+    SDL_LockMutex(queue->lock);
+    if (queue->bottom > queue->top) {
+        *item = queue->items[queue->top % POOL_QUEUE_SIZE];
+        queue->top++;
+        found = true;
+    }
+    SDL_UnlockMutex(queue->lock);
+    return found;
+}
+
+static bool pushBottom(WorkQueue* queue, PoolItem item) {
+    bool pushed = false;
+    SDL_LockMutex(queue->lock);
+    if (queue->bottom - queue->top < POOL_QUEUE_SIZE) {
+        queue->items[queue->bottom % POOL_QUEUE_SIZE] = item;
+        queue->bottom++;
+        pushed = true;
+    }
+    SDL_UnlockMutex(queue->lock);
+    return pushed;
+}
+
+static bool findWork(ThreadPool* pool, int self, PoolItem* item) {
+    if (popBottom(&pool->queues[self], item)) {
+        return true;
+    }
+
+    // Tentar roubar, começando pelo vizinho para espalhar a disputa
+    for (int i = 1; i < pool->workerCount; i++) {
+        int victim = (self + i) % pool->workerCount;
+        if (stealTop(&pool->queues[victim], item)) {
+            SDL_AtomicAdd(&pool->steals, 1);
+            return true;
+        }
+    }
+    return false;
+}
+
+static int workerMain(void* data) {
+    WorkerContext* context = (WorkerContext*)data;
+    ThreadPool* pool = context->pool;
+    PoolItem item;
+
+    while (!SDL_AtomicGet(&pool->stopping)) {
+        if (findWork(pool, context->index, &item)) {
+            item.function(pool, context->index, item.data);
+
+            if (SDL_AtomicAdd(&pool->pending, -1) == 1) {
+                SDL_LockMutex(pool->sleepLock);
+                SDL_CondBroadcast(pool->allDone);
+                SDL_UnlockMutex(pool->sleepLock);
+            }
+            continue;
+        }
+
+        // Sem trabalho: dormir até um novo envio (o timeout cobre avisos perdidos)
+        SDL_LockMutex(pool->sleepLock);
+        if (!SDL_AtomicGet(&pool->stopping)) {
+            SDL_CondWaitTimeout(pool->wakeUp, pool->sleepLock, 10);
+        }
+        SDL_UnlockMutex(pool->sleepLock);
+    }
+    return 0;
+}
+
+ThreadPool* createThreadPool(int workerCount) {
+    if (workerCount <= 0) {
+        workerCount = SDL_GetCPUCount();
+    }
+    if (workerCount > POOL_MAX_WORKERS) {
+        workerCount = POOL_MAX_WORKERS;
+    }
+
+    ThreadPool* pool = (ThreadPool*)calloc(1, sizeof(ThreadPool));
+    if (!pool) {
+        return NULL;
+    }
+
+    pool->workerCount = workerCount;
+    pool->sleepLock = SDL_CreateMutex();
+    pool->wakeUp = SDL_CreateCond();
+    pool->allDone = SDL_CreateCond();
+
+    for (int i = 0; i < workerCount; i++) {
+        pool->queues[i].lock = SDL_CreateMutex();
+        pool->contexts[i].pool = pool;
+        pool->contexts[i].index = i;
+    }
+    for (int i = 0; i < workerCount; i++) {
+        pool->threads[i] = SDL_CreateThread(workerMain, "matecheck-worker", &pool->contexts[i]);
+        if (!pool->threads[i]) {
+            printf("Erro ao criar thread: %s\n", SDL_GetError());
+            pool->workerCount = i;
+            break;
+        }
+    }
+
+    if (pool->workerCount == 0) {
+        destroyThreadPool(pool);
+        return NULL;
+    }
+    return pool;
+}
+
+// Envia uma tarefa. Dentro de uma tarefa, passe o próprio índice do worker
+// para empilhar na fila local; de fora do pool, use -1.
+bool submitTask(ThreadPool* pool, int worker, PoolTask function, void* data) {
+    PoolItem item = {function, data};
+    int target = worker;
+    if (target < 0 || target >= pool->workerCount) {
+        target = (SDL_AtomicAdd(&pool->nextQueue, 1) & 0x7FFFFFFF) % pool->workerCount;
+    }
+
+    SDL_AtomicAdd(&pool->pending, 1);
+    if (!pushBottom(&pool->queues[target], item)) {
+        SDL_AtomicAdd(&pool->pending, -1);
+        return false;
+    }
+
+    SDL_LockMutex(pool->sleepLock);
+    SDL_CondSignal(pool->wakeUp);
+    SDL_UnlockMutex(pool->sleepLock);
+    return true;
+}
+
+// Espera até que não haja mais tarefas; o intervalo permite mostrar progresso
+bool waitThreadPool(ThreadPool* pool, Uint32 timeoutMs) {
+    SDL_LockMutex(pool->sleepLock);
+    if (SDL_AtomicGet(&pool->pending) > 0) {
+        SDL_CondWaitTimeout(pool->allDone, pool->sleepLock, timeoutMs);
+    }
+    bool done = SDL_AtomicGet(&pool->pending) == 0;
+    SDL_UnlockMutex(pool->sleepLock);
+    return done;
+}
+
+int getThreadPoolSize(ThreadPool* pool) {
+    return pool->workerCount;
+}
+
+int getThreadPoolSteals(ThreadPool* pool) {
+    return SDL_AtomicGet(&pool->steals);
+}
+
+void destroyThreadPool(ThreadPool* pool) {
+    if (!pool) return;
+
+    SDL_AtomicSet(&pool->stopping, 1);
+    SDL_LockMutex(pool->sleepLock);
+    SDL_CondBroadcast(pool->wakeUp);
+    SDL_UnlockMutex(pool->sleepLock);
+
+    for (int i = 0; i < pool->workerCount; i++) {
+        SDL_WaitThread(pool->threads[i], NULL);
+    }
+    for (int i = 0; i < POOL_MAX_WORKERS; i++) {
+        if (pool->queues[i].lock) {
+            SDL_DestroyMutex(pool->queues[i].lock);
+        }
+    }
+
+    SDL_DestroyCond(pool->allDone);
+    SDL_DestroyCond(pool->wakeUp);
+    SDL_DestroyMutex(pool->sleepLock);
+    free(pool);
+}
@@ -0,0 +1,293 @@
+#include "chess_engine.h"
+
+#include <stdarg.h>
+
+// Frontend UCI (matecheck-uci)
+// A thread principal lê os comandos da entrada padrão; go dispara a busca
+// numa thread separada e volta a ler, então stop, ponderhit, isready e quit
+// são atendidos no meio da busca. Em go infinite e go ponder o bestmove só
+// sai depois de stop ou ponderhit, como o protocolo exige.
+
+#define UCI_LINE_LENGTH 16384       // position startpos moves ... de partidas longas
+
+typedef struct {
+    ChessBoard board;                   // Posição do último comando position
+    Uint64 history[MAX_MOVES];          // Hashes das posições anteriores a ela
+    int historyCount;
+
+    ChessBoard searchBoard;             // Cópia entregue à thread de busca
+    SearchLimits limits;
+    Uint32 ponderBudget;                // Prazo aplicado no ponderhit
+    SDL_Thread* thread;
+    SDL_atomic_t holdBestMove;          // go infinite / ponder ainda sem stop
+    SDL_sem* released;                  // Sinalizado por stop e ponderhit
+} UciEngine;
+
+// Uma linha por chamada: a thread de busca e a principal escrevem juntas
+static void uciSend(const char* format, ...) {
+    char line[1024];
+    va_list args;
+    va_start(args, format);
+    int length = vsnprintf(line, sizeof(line) - 1, format, args);
+    va_end(args);
+    if (length < 0) return;
+    if (length > (int)sizeof(line) - 2) length = (int)sizeof(line) - 2;
+    line[length] = '\n';
+    line[length + 1] = '\0';
+    fputs(line, stdout);
+    fflush(stdout);
+}
+
+// position [startpos | fen <FEN>] [moves <lances>]
+static void handlePosition(UciEngine* engine, char* arguments) {
+    char* moves = strstr(arguments, "moves");
+    if (moves) {
+        *moves = '\0';
+        moves += strlen("moves");
+    }
+
+    ChessBoard board;
+    if (strncmp(arguments, "fen", 3) == 0) {
+        if (!loadFEN(&board, arguments + 3 + strspn(arguments + 3, " "))) {
+            uciSend("info string FEN inválida");
+            return;
+        }
+    } else {
+        loadFEN(&board, STARTING_FEN);
+    }
+
+    engine->historyCount = 0;
+    for (char* token = moves ? strtok(moves, " \t") : NULL; token; token = strtok(NULL, " \t")) {
+        Move move;
+        if (!parseUCIMove(&board, token, &move)) {
+            uciSend("info string lance ilegal: %s", token);
+            break;
+        }
+        // Só as posições guardadas podem se repetir; mais antigas saem
+        if (engine->historyCount == MAX_MOVES) {
+            memmove(engine->history, engine->history + 1, (MAX_MOVES - 1) * sizeof(Uint64));
+            engine->historyCount--;
+        }
+        engine->history[engine->historyCount++] = computeBoardHash(&board);
+        MoveUndo undo;
+        applyMove(&board, move, &undo);
+    }
+    engine->board = board;
+}
+
+static void reportSearchInfo(const SearchInfo* info, void* data) {
+    (void)data;
+    char line[1024];
+    int length;
+    if (info->score > SEARCH_MATE_SCORE - SEARCH_MAX_PLY) {
+        length = snprintf(line, sizeof(line), "score mate %d", (SEARCH_MATE_SCORE - info->score + 1) / 2);
+    } else if (info->score < -SEARCH_MATE_SCORE + SEARCH_MAX_PLY) {
+        length = snprintf(line, sizeof(line), "score mate -%d", (SEARCH_MATE_SCORE + info->score) / 2);
+    } else {
+        length = snprintf(line, sizeof(line), "score cp %d", info->score);
+    }
+    long long nps = info->nodes * 1000 / (info->timeMs > 0 ? info->timeMs : 1);
+    length += snprintf(line + length, sizeof(line) - (size_t)length, " nodes %lld nps %lld hashfull %d time %u pv",
+                       info->nodes, nps, info->hashfull, (unsigned)info->timeMs);
+    for (int i = 0; i < info->pvLength && length < (int)sizeof(line) - 8; i++) {
+        char move[UCI_MOVE_LENGTH];
+        moveToUCI(info->pv[i], move);
+        length += snprintf(line + length, sizeof(line) - (size_t)length, " %s", move);
+    }
+    uciSend("info depth %d %s", info->depth, line);
+}
+
+static int searchThreadMain(void* data) {
+    UciEngine* engine = (UciEngine*)data;
+    Move ponder;
+    Move best = searchBestMove(&engine->searchBoard, engine->history, engine->historyCount,
+                               &engine->limits, reportSearchInfo, NULL, &ponder);
+
+    while (SDL_AtomicGet(&engine->holdBestMove)) {
+        SDL_SemWait(engine->released);
+    }
+
+    char bestText[UCI_MOVE_LENGTH], ponderText[UCI_MOVE_LENGTH];
+    if (best.from.x < 0) {
+        uciSend("bestmove 0000");
+    } else if (ponder.from.x >= 0) {
+        moveToUCI(best, bestText);
+        moveToUCI(ponder, ponderText);
+        uciSend("bestmove %s ponder %s", bestText, ponderText);
+    } else {
+        moveToUCI(best, bestText);
+        uciSend("bestmove %s", bestText);
+    }
+    return 0;
+}
+
+// Libera o bestmove retido (stop, ponderhit)
+static void releaseBestMove(UciEngine* engine) {
+    SDL_AtomicSet(&engine->holdBestMove, 0);
+    SDL_SemPost(engine->released);
+}
+
+static void finishSearch(UciEngine* engine) {
+    if (!engine->thread) return;
+    setSearchStopped(true);
+    releaseBestMove(engine);
+    SDL_WaitThread(engine->thread, NULL);
+    engine->thread = NULL;
+    while (SDL_SemTryWait(engine->released) == 0) {}
+}
+
+// Tempo para o lance: uma fração do relógio mais a maior parte do incremento
+static Uint32 allocateMoveTime(long timeLeft, long increment, int movesToGo) {
+    long budget = timeLeft / (movesToGo > 0 ? movesToGo + 1 : 30) + increment * 3 / 4;
+    long available = timeLeft - SEARCH_MOVE_OVERHEAD_MS;
+    if (budget > available) budget = available;
+    return budget > 1 ? (Uint32)budget : 1;
+}
+
+// go [wtime btime winc binc movestogo depth nodes movetime infinite ponder]
+static void handleGo(UciEngine* engine, char* arguments) {
+    finishSearch(engine);
+
+    long clock[2] = {-1, -1}, increment[2] = {0, 0}, moveTime = -1;
+    int movesToGo = 0;
+    bool infinite = false, pondering = false;
+    memset(&engine->limits, 0, sizeof(engine->limits));
+
+    for (char* token = strtok(arguments, " \t"); token; token = strtok(NULL, " \t")) {
+        if (strcmp(token, "infinite") == 0) {
+            infinite = true;
+        } else if (strcmp(token, "ponder") == 0) {
+            pondering = true;
+        } else {
+            char* value = strtok(NULL, " \t");
+            if (!value) break;
+            if (strcmp(token, "wtime") == 0) clock[COLOR_WHITE_PIECE] = atol(value);
+            else if (strcmp(token, "btime") == 0) clock[COLOR_BLACK_PIECE] = atol(value);
+            else if (strcmp(token, "winc") == 0) increment[COLOR_WHITE_PIECE] = atol(value);
+            else if (strcmp(token, "binc") == 0) increment[COLOR_BLACK_PIECE] = atol(value);
+            else if (strcmp(token, "movestogo") == 0) movesToGo = atoi(value);
+            else if (strcmp(token, "depth") == 0) engine->limits.depth = atoi(value);
+            else if (strcmp(token, "nodes") == 0) engine->limits.nodes = atoll(value);
+            else if (strcmp(token, "movetime") == 0) moveTime = atol(value);
+        }
+    }
+
+    int side = engine->board.currentPlayer;
+    Uint32 budget = 0;
+    if (moveTime >= 0) {
+        budget = moveTime > SEARCH_MOVE_OVERHEAD_MS ? (Uint32)(moveTime - SEARCH_MOVE_OVERHEAD_MS) : 1;
+    } else if (clock[side] >= 0) {
+        budget = allocateMoveTime(clock[side], increment[side], movesToGo);
+    }
+
+    engine->ponderBudget = budget;
+    setSearchDeadline(infinite || pondering ? 0 : budget);
+    SDL_AtomicSet(&engine->holdBestMove, infinite || pondering);
+    setSearchStopped(false);
+
+    engine->searchBoard = engine->board;
+    engine->thread = SDL_CreateThread(searchThreadMain, "matecheck-search", engine);
+    if (!engine->thread) {
+        uciSend("info string erro ao criar a thread de busca");
+        uciSend("bestmove 0000");
+    }
+}
+
+// setoption name <nome> [value <valor>]
+static void handleSetOption(UciEngine* engine, char* arguments) {
+    char* name = strstr(arguments, "name");
+    if (!name) return;
+    name += strlen("name");
+    char* value = strstr(name, " value");
+    if (value) {
+        *value = '\0';
+        value += strlen(" value");
+        value += strspn(value, " ");
+    }
+    name += strspn(name, " ");
+
+    // Mudar a tabela ou as threads no meio da busca não é permitido
+    finishSearch(engine);
+    if (SDL_strcasecmp(name, "Hash") == 0 && value) {
+        int megabytes = CLAMP(atoi(value), 1, SEARCH_MAX_HASH_MB);
+        if (!resizeSearchTable(megabytes)) {
+            uciSend("info string memória insuficiente para %d MB", megabytes);
+        }
+    } else if (SDL_strcasecmp(name, "Threads") == 0 && value) {
+        if (!setSearchThreads(CLAMP(atoi(value), 1, SEARCH_MAX_THREADS))) {
+            uciSend("info string erro ao criar as threads auxiliares");
+        }
+    } else if (SDL_strcasecmp(name, "Clear Hash") == 0) {
+        clearSearchTable();
+    }
+}
+
+static bool handleCommand(UciEngine* engine, char* line) {
+    line[strcspn(line, "\r\n")] = '\0';
+    char* command = line + strspn(line, " \t");
+    size_t length = strcspn(command, " \t");
+    char* arguments = command + length;
+    if (*arguments) {
+        *arguments++ = '\0';
+        arguments += strspn(arguments, " \t");
+    }
+
+    if (strcmp(command, "uci") == 0) {
+        uciSend("id name MateCheck %d.%d.%d", VERSION_MAJOR, VERSION_MINOR, VERSION_PATCH);
+        uciSend("id author MateCheck");
+        uciSend("option name Hash type spin default %d min 1 max %d", SEARCH_DEFAULT_HASH_MB, SEARCH_MAX_HASH_MB);
+        uciSend("option name Threads type spin default 1 min 1 max %d", SEARCH_MAX_THREADS);
+        uciSend("option name Ponder type check default false");
+        uciSend("option name Clear Hash type button");
+        uciSend("uciok");
+    } else if (strcmp(command, "isready") == 0) {
+        uciSend("readyok");
+    } else if (strcmp(command, "ucinewgame") == 0) {
+        finishSearch(engine);
+        clearSearchTable();
+    } else if (strcmp(command, "position") == 0) {
+        finishSearch(engine);
+        handlePosition(engine, arguments);
+    } else if (strcmp(command, "go") == 0) {
+        handleGo(engine, arguments);
+    } else if (strcmp(command, "stop") == 0) {
+        finishSearch(engine);
+    } else if (strcmp(command, "ponderhit") == 0) {
+        // O lance previsto foi jogado: a busca continua, agora com relógio
+        if (engine->thread) {
+            setSearchDeadline(engine->ponderBudget);
+            releaseBestMove(engine);
+        }
+    } else if (strcmp(command, "setoption") == 0) {
+        handleSetOption(engine, arguments);
+    } else if (strcmp(command, "quit") == 0) {
+        return false;
+    } else if (*command) {
+        uciSend("info string comando desconhecido: %s", command);
+    }
+    return true;
+}
+
+int main(int argc, char* argv[]) {
+    (void)argc;
+    (void)argv;
+    static UciEngine engine;
+    static char line[UCI_LINE_LENGTH];
+
+    setvbuf(stdout, NULL, _IOLBF, 0);
+    engine.released = SDL_CreateSemaphore(0);
+    if (!engine.released || !resizeSearchTable(SEARCH_DEFAULT_HASH_MB)) {
+        printf("Erro ao iniciar o motor\n");
+        return 1;
+    }
+    loadFEN(&engine.board, STARTING_FEN);
+
+    while (fgets(line, sizeof(line), stdin)) {
+        if (!handleCommand(&engine, line)) break;
+    }
+
+    finishSearch(&engine);
+    setSearchThreads(1);
+    SDL_DestroySemaphore(engine.released);
+    return 0;
+}
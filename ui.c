@@ -1,33 +1,39 @@
 #include "chess_engine.h"
 
 void drawMenu(ChessGame* game, Menu* menu) {
+    const Layout* layout = &game->layout;
+    int centerX = layout->width / 2;
+    
     // Desenhar fundo
     SDL_SetRenderDrawColor(game->renderer, 20, 20, 40, 255);
     SDL_RenderClear(game->renderer);
     
     // Título
-    drawText(game, "MATE CHECK", WINDOW_WIDTH/2 - 100, 100, COLOR_WHITE);
-    drawText(game, "Jogo de Xadrez Educacional", WINDOW_WIDTH/2 - 150, 140, COLOR_LIGHT_BROWN);
+    drawText(game, "MATE CHECK", centerX - layoutScaled(layout, 100), layoutScaled(layout, 100), COLOR_WHITE);
+    drawText(game, "Jogo de Xadrez Educacional", centerX - layoutScaled(layout, 150),
+             layoutScaled(layout, 140), COLOR_LIGHT_BROWN);
     
     // Opções do menu
     for (int i = 0; i < menu->totalOptions; i++) {
         SDL_Color color = (i == menu->selectedOption) ? COLOR_HIGHLIGHT : COLOR_WHITE;
-        int y = 250 + i * 50;
+        int y = layoutScaled(layout, 250 + i * 50);
         
         // Destacar opção selecionada
         if (i == menu->selectedOption) {
-            SDL_Rect highlightRect = {WINDOW_WIDTH/2 - 200, y - 5, 400, 40};
+            SDL_Rect highlightRect = {centerX - layoutScaled(layout, 200), y - layoutScaled(layout, 5),
+                                      layoutScaled(layout, 400), layoutScaled(layout, 40)};
             SDL_SetRenderDrawColor(game->renderer, 255, 255, 0, 50);
             SDL_RenderFillRect(game->renderer, &highlightRect);
         }
         
-        drawText(game, menu->options[i], WINDOW_WIDTH/2 - 180, y, color);
+        drawText(game, menu->options[i], centerX - layoutScaled(layout, 180), y, color);
     }
     
     // Instruções
     drawText(game, "Use as setas para navegar e ENTER para selecionar", 
-             WINDOW_WIDTH/2 - 200, WINDOW_HEIGHT - 100, COLOR_LIGHT_BROWN);
-    drawText(game, "ESC para sair", WINDOW_WIDTH/2 - 80, WINDOW_HEIGHT - 70, COLOR_LIGHT_BROWN);
+             centerX - layoutScaled(layout, 200), layout->height - layoutScaled(layout, 100), COLOR_LIGHT_BROWN);
+    drawText(game, "ESC para sair", centerX - layoutScaled(layout, 80),
+             layout->height - layoutScaled(layout, 70), COLOR_LIGHT_BROWN);
 }
 
 void handleMenuInput(ChessGame* game, Menu* menu, SDL_Event* event) {
@@ -73,32 +79,47 @@ void handleMenuInput(ChessGame* game, Menu* menu, SDL_Event* event) {
 
 void drawUI(ChessGame* game) {
     // Painel lateral
-    SDL_Rect panelRect = {900, 0, 100, WINDOW_HEIGHT};
+    SDL_Rect panelRect = {game->layout.panelX, 0, game->layout.panelWidth, game->layout.height};
     SDL_SetRenderDrawColor(game->renderer, 40, 40, 60, 255);
     SDL_RenderFillRect(game->renderer, &panelRect);
     
     // Informações do jogo
     char scoreText[50];
     sprintf(scoreText, "Pontos: %d", game->score);
-    drawText(game, scoreText, 920, 150, COLOR_WHITE);
+    drawPanelText(game, scoreText, 150, COLOR_WHITE);
     
     char moveText[50];
     sprintf(moveText, "Movimentos: %d", game->board.moveCount);
-    drawText(game, moveText, 920, 180, COLOR_WHITE);
+    drawPanelText(game, moveText, 180, COLOR_WHITE);
     
     char playerText[50];
     sprintf(playerText, "Jogador: %s", game->playerName);
-    drawText(game, playerText, 920, 210, COLOR_WHITE);
+    drawPanelText(game, playerText, 210, COLOR_WHITE);
+    
+    if (countRepetitions(game) >= 2) {
+        drawPanelText(game, "Empate: repetição", 240, COLOR_HIGHLIGHT);
+    }
     
     // Instruções
-    drawText(game, "Clique para", 920, 300, COLOR_LIGHT_BROWN);
-    drawText(game, "selecionar", 920, 320, COLOR_LIGHT_BROWN);
-    drawText(game, "Clique para", 920, 350, COLOR_LIGHT_BROWN);
-    drawText(game, "mover", 920, 370, COLOR_LIGHT_BROWN);
-    drawText(game, "ESC para", 920, 400, COLOR_LIGHT_BROWN);
-    drawText(game, "desselecionar", 920, 420, COLOR_LIGHT_BROWN);
-    drawText(game, "R para", 920, 450, COLOR_LIGHT_BROWN);
-    drawText(game, "reiniciar", 920, 470, COLOR_LIGHT_BROWN);
+    drawPanelText(game, "Clique para", 300, COLOR_LIGHT_BROWN);
+    drawPanelText(game, "selecionar", 320, COLOR_LIGHT_BROWN);
+    drawPanelText(game, "Clique para", 350, COLOR_LIGHT_BROWN);
+    drawPanelText(game, "mover", 370, COLOR_LIGHT_BROWN);
+    drawPanelText(game, "ESC para", 400, COLOR_LIGHT_BROWN);
+    drawPanelText(game, "desselecionar", 420, COLOR_LIGHT_BROWN);
+    drawPanelText(game, "R para", 450, COLOR_LIGHT_BROWN);
+    drawPanelText(game, "reiniciar", 470, COLOR_LIGHT_BROWN);
+    drawPanelText(game, "V para", 500, COLOR_LIGHT_BROWN);
+    drawPanelText(game, "ver a busca", 520, COLOR_LIGHT_BROWN);
+    drawPanelText(game, "Z/Y desfazer/refazer", 640, COLOR_LIGHT_BROWN);
+    drawPanelText(game, "F5/F9 salvar/abrir", 660, COLOR_LIGHT_BROWN);
+    drawPanelText(game, "F6/F7 PGN", 680, COLOR_LIGHT_BROWN);
+    if (game->difficulty == 3) {
+        drawPanelText(game, "M para mate", 700, COLOR_LIGHT_BROWN);
+        if (game->solverStatus[0]) {
+            drawPanelText(game, game->solverStatus, 730, COLOR_MOVE_HINT);
+        }
+    }
     
     // Dificuldade atual
     char diffText[30];
@@ -108,56 +129,284 @@ void drawUI(ChessGame* game) {
         case 3: strcpy(diffText, "Mestre"); break;
         default: strcpy(diffText, "Desconhecido"); break;
     }
-    drawText(game, diffText, 920, 550, COLOR_HIGHLIGHT);
+    drawPanelText(game, diffText, 550, COLOR_HIGHLIGHT);
+    
+    // Progresso da busca visualizada
+    if (game->visualizer.active) {
+        char searchText[64];
+        drawPanelText(game, getSearchAlgorithmName(game->visualizer.algorithm), 580, COLOR_MOVE_HINT);
+        sprintf(searchText, "%lld passos", game->visualizer.steps);
+        drawPanelText(game, searchText, 600, COLOR_WHITE);
+        if (game->visualizer.bestMoves >= 0) {
+            sprintf(searchText, "Melhor: %d", game->visualizer.bestMoves);
+            drawPanelText(game, searchText, 620, COLOR_WHITE);
+        }
+    }
 }
 
-void drawText(ChessGame* game, const char* text, int x, int y, SDL_Color color) {
-    if (!game->font) return;
-    
+// Cache de textos renderizados, chaveado por (fonte, texto, cor)
+// Os mesmos rótulos são desenhados a cada quadro; com o cache, cada um é
+// rasterizado e enviado à GPU uma única vez. Quando o número de entradas ou a
+// memória estimada passa do limite, sai o texto usado há mais tempo (LRU).
+typedef struct {
+    bool used;
+    Uint32 hash;
+    TTF_Font* font;
+    SDL_Color color;
+    char text[TEXT_CACHE_KEY_LENGTH];
+    SDL_Texture* texture;
+    int w, h;
+    Uint32 lastUsed;
+} TextCacheEntry;
+
+static TextCacheEntry textCache[TEXT_CACHE_ENTRIES];
+static SDL_Renderer* textCacheRenderer = NULL;
+static size_t textCacheBytes = 0;
+static Uint32 textCacheClock = 0;
+
+static Uint32 hashText(TTF_Font* font, const char* text, SDL_Color color) {
+    // FNV-1a sobre o texto, misturando fonte e cor
+    Uint32 hash = 2166136261u ^ (Uint32)(uintptr_t)font;
+    hash = (hash ^ ((Uint32)color.r << 24 | (Uint32)color.g << 16 | (Uint32)color.b << 8 | color.a)) * 16777619u;
+    for (const unsigned char* c = (const unsigned char*)text; *c; c++) {
+        hash = (hash ^ *c) * 16777619u;
+    }
+    return hash;
+}
+
+static void evictTextEntry(TextCacheEntry* entry) {
+    SDL_DestroyTexture(entry->texture);
+    textCacheBytes -= (size_t)entry->w * entry->h * 4;
+    entry->used = false;
+    entry->texture = NULL;
+}
+
+static TextCacheEntry* findLeastRecentText(void) {
+    TextCacheEntry* oldest = NULL;
+    for (int i = 0; i < TEXT_CACHE_ENTRIES; i++) {
+        if (textCache[i].used && (!oldest || textCache[i].lastUsed < oldest->lastUsed)) {
+            oldest = &textCache[i];
+        }
+    }
+    return oldest;
+}
+
+void clearTextCache(void) {
+    for (int i = 0; i < TEXT_CACHE_ENTRIES; i++) {
+        if (textCache[i].used) {
+            evictTextEntry(&textCache[i]);
+        }
+    }
+    textCacheBytes = 0;
+    textCacheRenderer = NULL;
+}
+
+static TextCacheEntry* getCachedText(ChessGame* game, const char* text, SDL_Color color) {
+    // Texturas pertencem ao renderer: trocar de renderer invalida o cache
+    if (textCacheRenderer != game->renderer) {
+        clearTextCache();
+        textCacheRenderer = game->renderer;
+    }
+
+    Uint32 hash = hashText(game->font, text, color);
+    TextCacheEntry* freeSlot = NULL;
+    textCacheClock++;
+
+    for (int i = 0; i < TEXT_CACHE_ENTRIES; i++) {
+        TextCacheEntry* entry = &textCache[i];
+        if (!entry->used) {
+            if (!freeSlot) freeSlot = entry;
+            continue;
+        }
+        if (entry->hash == hash && entry->font == game->font &&
+            memcmp(&entry->color, &color, sizeof(SDL_Color)) == 0 &&
+            strcmp(entry->text, text) == 0) {
+            entry->lastUsed = textCacheClock;
+            return entry;
+        }
+    }
+
+    // Falta no cache: rasterizar uma vez
     SDL_Surface* textSurface = TTF_RenderText_Solid(game->font, text, color);
-    if (!textSurface) return;
-    
+    if (!textSurface) return NULL;
+
     SDL_Texture* textTexture = SDL_CreateTextureFromSurface(game->renderer, textSurface);
-    if (!textTexture) {
+    int w = textSurface->w;
+    int h = textSurface->h;
+    SDL_FreeSurface(textSurface);
+    if (!textTexture) return NULL;
+
+    size_t bytes = (size_t)w * h * 4;
+    while (textCacheBytes + bytes > TEXT_CACHE_MAX_BYTES || !freeSlot) {
+        TextCacheEntry* oldest = findLeastRecentText();
+        if (!oldest) break;
+        evictTextEntry(oldest);
+        if (!freeSlot) freeSlot = oldest;
+    }
+
+    freeSlot->used = true;
+    freeSlot->hash = hash;
+    freeSlot->font = game->font;
+    freeSlot->color = color;
+    strcpy(freeSlot->text, text);
+    freeSlot->texture = textTexture;
+    freeSlot->w = w;
+    freeSlot->h = h;
+    freeSlot->lastUsed = textCacheClock;
+    textCacheBytes += bytes;
+    return freeSlot;
+}
+
+static void renderText(ChessGame* game, const char* text, int x, int y, SDL_Color color) {
+    // Textos longos demais para a chave são desenhados sem cache
+    if (strlen(text) >= TEXT_CACHE_KEY_LENGTH) {
+        SDL_Surface* textSurface = TTF_RenderText_Solid(game->font, text, color);
+        if (!textSurface) return;
+        
+        SDL_Texture* textTexture = SDL_CreateTextureFromSurface(game->renderer, textSurface);
+        if (textTexture) {
+            SDL_Rect textRect = {x, y, textSurface->w, textSurface->h};
+            SDL_RenderCopy(game->renderer, textTexture, NULL, &textRect);
+            SDL_DestroyTexture(textTexture);
+        }
         SDL_FreeSurface(textSurface);
         return;
     }
     
-    SDL_Rect textRect = {x, y, textSurface->w, textSurface->h};
-    SDL_RenderCopy(game->renderer, textTexture, NULL, &textRect);
+    TextCacheEntry* entry = getCachedText(game, text, color);
+    if (!entry) return;
     
-    SDL_DestroyTexture(textTexture);
-    SDL_FreeSurface(textSurface);
+    SDL_Rect textRect = {x, y, entry->w, entry->h};
+    SDL_RenderCopy(game->renderer, entry->texture, NULL, &textRect);
+}
+
+void drawText(ChessGame* game, const char* text, int x, int y, SDL_Color color) {
+    if (!text[0]) return;
+    
+    PROFILE_BEGIN(PROFILE_TEXT);
+    if (game->font) {
+        renderText(game, text, x, y, color);
+    } else {
+        // Fonte ainda carregando (ou ausente): fonte embutida
+        drawFallbackText(game, text, x, y, color);
+    }
+    PROFILE_END(PROFILE_TEXT);
 }
 
 bool initAudio(ChessGame* game) {
-    if (Mix_OpenAudio(44100, MIX_DEFAULT_FORMAT, 2, 2048) < 0) {
-        printf("Erro ao inicializar áudio: %s\n", Mix_GetError());
+    // Só abre o dispositivo: sons e música são carregados (ou sintetizados,
+    // uma única vez) pelo carregador de assets em segundo plano
+    (void)game;
+    if (Mix_OpenAudio(AUDIO_SAMPLE_RATE, MIX_DEFAULT_FORMAT, AUDIO_CHANNELS, AUDIO_BUFFER_SIZE) < 0) {
+        LOG_ERROR("Erro ao inicializar áudio: %s", Mix_GetError());
         return false;
     }
     
-    // Carregar sons (se existirem)
-    game->backgroundMusic = Mix_LoadMUS("assets/sounds/background.wav");
-    game->moveSound = Mix_LoadWAV("assets/sounds/move.wav");
-    game->captureSound = Mix_LoadWAV("assets/sounds/capture.wav");
+    return true;
+}
+
+// Síntese dos efeitos sonoros
+// A fundamental e dois harmônicos são lidos de uma tabela de seno (montada
+// uma vez) com acumuladores de fase de 32 bits, sob um envelope de ataque
+// curto e decaimento exponencial. As amostras saem direto no formato, na
+// taxa e no número de canais do mixer, prontas para Mix_PlayChannel.
+
+#define SYNTH_TABLE_BITS 10
+#define SYNTH_TABLE_SIZE (1 << SYNTH_TABLE_BITS)
+#define SYNTH_ATTACK 0.005f         // Segundos até o volume máximo
+#define SYNTH_RELEASE_DB 60.0f      // Queda do envelope até o fim do som
+#define SYNTH_VOLUME 0.4f
+
+static const float harmonicGains[] = {1.0f, 0.45f, 0.2f};  // Fundamental, 2º e 3º harmônicos
+static float sineTable[SYNTH_TABLE_SIZE];
+static bool sineTableReady = false;
+
+// Grava uma amostra em [-1, 1] no formato de áudio do SDL
+static void writeSample(Uint8* out, Uint16 format, float value) {
+    int bytes = SDL_AUDIO_BITSIZE(format) / 8;
+    Uint32 bits;
     
-    // Se não conseguir carregar os arquivos, criar sons simples
-    if (!game->moveSound) {
-        // Criar som simples de movimento
-        game->moveSound = createSimpleSound(440, 0.1); // Nota Lá
-    }
-    if (!game->captureSound) {
-        // Criar som simples de captura
-        game->captureSound = createSimpleSound(880, 0.2); // Nota Lá oitava
+    if (SDL_AUDIO_ISFLOAT(format)) {
+        memcpy(&bits, &value, sizeof(bits));
+    } else if (bytes == 1) {
+        int sample = (int)(value * 127.0f);
+        bits = (Uint32)(SDL_AUDIO_ISSIGNED(format) ? sample : sample + 128);
+    } else if (bytes == 2) {
+        bits = (Uint32)(Sint32)(value * 32767.0f);
+        if (!SDL_AUDIO_ISSIGNED(format)) bits ^= 0x8000;
+    } else {
+        bits = (Uint32)(Sint32)(value * 2147483647.0f);
     }
     
-    return true;
+    for (int i = 0; i < bytes; i++) {
+        int shift = SDL_AUDIO_ISBIGENDIAN(format) ? (bytes - 1 - i) * 8 : i * 8;
+        out[i] = (Uint8)(bits >> shift);
+    }
 }
 
 Mix_Chunk* createSimpleSound(int frequency, float duration) {
-    // Esta é uma implementação simplificada
-    // Em um projeto real, você usaria bibliotecas como PortAudio
-    return NULL;
+    int rate, channels;
+    Uint16 format;
+    if (!Mix_QuerySpec(&rate, &format, &channels) || frequency <= 0 || duration <= 0.0f) {
+        return NULL;
+    }
+    
+    if (!sineTableReady) {
+        for (int i = 0; i < SYNTH_TABLE_SIZE; i++) {
+            sineTable[i] = sinf(6.2831853f * i / SYNTH_TABLE_SIZE);
+        }
+        sineTableReady = true;
+    }
+    
+    int frames = (int)(rate * duration);
+    int sampleBytes = SDL_AUDIO_BITSIZE(format) / 8;
+    int frameBytes = sampleBytes * channels;
+    Uint8* buffer = (Uint8*)SDL_malloc((size_t)frames * frameBytes);
+    if (!buffer || frames <= 0) {
+        SDL_free(buffer);
+        return NULL;
+    }
+    
+    // Passo de fase em 32 bits: o estouro do inteiro dá a volta na tabela
+    Uint32 phaseStep = (Uint32)((double)frequency * 4294967296.0 / rate);
+    Uint32 phase = 0;
+    int harmonics = (int)(sizeof(harmonicGains) / sizeof(harmonicGains[0]));
+    float gainSum = 0.0f;
+    for (int h = 0; h < harmonics; h++) {
+        gainSum += harmonicGains[h];
+    }
+    
+    int attackFrames = (int)(rate * SYNTH_ATTACK) + 1;
+    float decay = powf(10.0f, -SYNTH_RELEASE_DB / 20.0f / frames);
+    float envelope = SYNTH_VOLUME / gainSum;
+    
+    for (int i = 0; i < frames; i++) {
+        float value = 0.0f;
+        for (int h = 0; h < harmonics; h++) {
+            // Harmônicos acima de Nyquist seriam rebatidos: ficam de fora
+            if ((double)frequency * (h + 1) * 2 >= rate) break;
+            Uint32 harmonicPhase = phase * (Uint32)(h + 1);
+            value += harmonicGains[h] * sineTable[harmonicPhase >> (32 - SYNTH_TABLE_BITS)];
+        }
+        phase += phaseStep;
+        
+        float attack = i < attackFrames ? (float)i / attackFrames : 1.0f;
+        value *= envelope * attack;
+        envelope *= decay;
+        
+        Uint8* frame = buffer + (size_t)i * frameBytes;
+        for (int c = 0; c < channels; c++) {
+            writeSample(frame + c * sampleBytes, format, value);
+        }
+    }
+    
+    Mix_Chunk* chunk = Mix_QuickLoad_RAW(buffer, (Uint32)frames * frameBytes);
+    if (!chunk) {
+        SDL_free(buffer);
+        return NULL;
+    }
+    chunk->allocated = 1;   // Mix_FreeChunk libera o buffer junto
+    return chunk;
 }
 
 void playSound(ChessGame* game, Mix_Chunk* sound) {
@@ -0,0 +1,259 @@
+#include "chess_engine.h"
+#include <limits.h>
+
+// Visualizador passo a passo das buscas do cavalo
+// As buscas (recursiva, com memoização e BFS) são máquinas de estado
+// retomáveis: a recursão virou uma pilha explícita, e cada chamada de
+// advanceVisualizer executa passos só até esgotar o orçamento de tempo do
+// quadro. O desenho usa apenas o estado das 64 casas e o fim do rastro,
+// então o custo por quadro é fixo, não importa o tamanho da busca.
+
+#define SQUARE_OPEN 1       // Na pilha ou na fila
+#define SQUARE_CLOSED 2     // Já explorada
+
+static const int knightSteps[8][2] = {
+    {2, 1}, {2, -1}, {-2, 1}, {-2, -1},
+    {1, 2}, {1, -2}, {-1, 2}, {-1, -2}
+};
+
+static int toSquare(Position pos) {
+    return pos.y * BOARD_SIZE + pos.x;
+}
+
+static int neighborSquare(int square, int move) {
+    Position next = {square % BOARD_SIZE + knightSteps[move][0],
+                     square / BOARD_SIZE + knightSteps[move][1]};
+    return isPositionValid(next) ? toSquare(next) : -1;
+}
+
+static void recordTrace(SearchVisualizer* vis, int square, TraceKind kind) {
+    TraceEvent* event = &vis->trace[vis->traceCount % VISUALIZER_TRACE_SIZE];
+    event->square = (unsigned char)square;
+    event->kind = (unsigned char)kind;
+    vis->traceCount++;
+}
+
+const char* getSearchAlgorithmName(SearchAlgorithm algorithm) {
+    switch (algorithm) {
+        case SEARCH_RECURSIVE: return "Recursiva";
+        case SEARCH_MEMOIZED: return "Memoização";
+        case SEARCH_BFS: return "BFS";
+        default: return "Desconhecida";
+    }
+}
+
+void startVisualizer(SearchVisualizer* vis, SearchAlgorithm algorithm, Position start, Position target) {
+    memset(vis, 0, sizeof(SearchVisualizer));
+    vis->active = true;
+    vis->algorithm = algorithm;
+    vis->start = start;
+    vis->target = target;
+    vis->bestMoves = -1;
+    vis->stepsPerFrame = VISUALIZER_STEPS_PER_FRAME;
+
+    for (int i = 0; i < BOARD_SIZE * BOARD_SIZE; i++) {
+        vis->bestDepth[i] = INT_MAX;
+        vis->parent[i] = -1;
+    }
+
+    int first = toSquare(start);
+    vis->bestDepth[first] = 0;
+    vis->squareState[first] = SQUARE_OPEN;
+    recordTrace(vis, first, TRACE_ENTER);
+
+    if (first == toSquare(target)) {
+        vis->bestMoves = 0;
+        vis->bestPath[0] = (unsigned char)first;
+        vis->finished = true;
+        return;
+    }
+
+    if (algorithm == SEARCH_BFS) {
+        vis->queue[vis->queueTail++] = (unsigned char)first;
+    } else {
+        vis->stack[0].square = (unsigned char)first;
+        vis->stack[0].nextMove = 0;
+        vis->onPath[first] = true;
+        vis->depth = 1;
+    }
+}
+
+// Um passo da busca em profundidade (recursiva ou memoizada): entra no
+// próximo vizinho promissor ou desempilha a casa atual (backtracking)
+static void stepDepthFirst(SearchVisualizer* vis) {
+    if (vis->depth == 0) {
+        vis->finished = true;
+        return;
+    }
+
+    SearchFrame* frame = &vis->stack[vis->depth - 1];
+    int moves = vis->depth - 1;
+    int goal = toSquare(vis->target);
+
+    while (frame->nextMove < 8) {
+        int next = neighborSquare(frame->square, frame->nextMove++);
+        if (next < 0) continue;
+
+        // Poda: não vale a pena ir além do melhor caminho já conhecido
+        if (vis->bestMoves >= 0 && moves + 1 >= vis->bestMoves) continue;
+
+        if (vis->algorithm == SEARCH_MEMOIZED) {
+            if (moves + 1 >= vis->bestDepth[next]) continue;
+            vis->bestDepth[next] = moves + 1;
+        } else if (vis->onPath[next]) {
+            continue;
+        }
+
+        recordTrace(vis, next, TRACE_ENTER);
+        vis->parent[next] = frame->square;
+
+        if (next == goal) {
+            // Guardar o caminho: a pilha atual mais o destino
+            for (int i = 0; i < vis->depth; i++) {
+                vis->bestPath[i] = vis->stack[i].square;
+            }
+            vis->bestPath[vis->depth] = (unsigned char)next;
+            vis->bestMoves = moves + 1;
+            vis->squareState[next] = SQUARE_CLOSED;
+            recordTrace(vis, next, TRACE_FOUND);
+            return;
+        }
+
+        vis->onPath[next] = true;
+        vis->squareState[next] = SQUARE_OPEN;
+        vis->stack[vis->depth].square = (unsigned char)next;
+        vis->stack[vis->depth].nextMove = 0;
+        vis->depth++;
+        return;
+    }
+
+    // Todos os vizinhos tentados: backtracking
+    vis->onPath[frame->square] = false;
+    vis->squareState[frame->square] = SQUARE_CLOSED;
+    recordTrace(vis, frame->square, TRACE_LEAVE);
+    vis->depth--;
+}
+
+// Um passo da BFS: expande a próxima casa da fila
+static void stepBreadthFirst(SearchVisualizer* vis) {
+    if (vis->queueHead == vis->queueTail) {
+        vis->finished = true;
+        return;
+    }
+
+    int current = vis->queue[vis->queueHead++];
+    int goal = toSquare(vis->target);
+    vis->squareState[current] = SQUARE_CLOSED;
+    recordTrace(vis, current, TRACE_LEAVE);
+
+    for (int i = 0; i < 8; i++) {
+        int next = neighborSquare(current, i);
+        if (next < 0 || vis->bestDepth[next] != INT_MAX) continue;
+
+        vis->bestDepth[next] = vis->bestDepth[current] + 1;
+        vis->parent[next] = current;
+        vis->squareState[next] = SQUARE_OPEN;
+        vis->queue[vis->queueTail++] = (unsigned char)next;
+        recordTrace(vis, next, TRACE_ENTER);
+
+        if (next == goal) {
+            // A primeira vez que a BFS alcança o destino já é o menor caminho
+            vis->bestMoves = vis->bestDepth[next];
+            int square = next;
+            for (int step = vis->bestMoves; step >= 0; step--) {
+                vis->bestPath[step] = (unsigned char)square;
+                square = vis->parent[square];
+            }
+            recordTrace(vis, next, TRACE_FOUND);
+            vis->finished = true;
+            return;
+        }
+    }
+}
+
+// Executa até stepLimit passos (0 = sem limite) ou até esgotar o orçamento
+// do quadro, o que vier primeiro. O relógio é consultado a cada
+// VISUALIZER_STEPS_PER_CHECK passos.
+bool advanceVisualizer(SearchVisualizer* vis, int stepLimit, Uint32 budgetMs) {
+    if (!vis->active || vis->finished) {
+        return vis->finished;
+    }
+
+    Uint64 deadline = SDL_GetPerformanceCounter() +
+                      SDL_GetPerformanceFrequency() * budgetMs / 1000;
+    int done = 0;
+    do {
+        for (int i = 0; i < VISUALIZER_STEPS_PER_CHECK && !vis->finished; i++) {
+            if (stepLimit > 0 && done == stepLimit) break;
+            if (vis->algorithm == SEARCH_BFS) {
+                stepBreadthFirst(vis);
+            } else {
+                stepDepthFirst(vis);
+            }
+            vis->steps++;
+            done++;
+        }
+    } while (!vis->finished && (stepLimit == 0 || done < stepLimit) &&
+             SDL_GetPerformanceCounter() < deadline);
+
+    return vis->finished;
+}
+
+static SDL_Rect squareRect(const Layout* layout, int square, int inset) {
+    SDL_Rect rect = getSquareRect(layout, square % BOARD_SIZE, square / BOARD_SIZE);
+    rect.x += inset;
+    rect.y += inset;
+    rect.w -= 2 * inset;
+    rect.h -= 2 * inset;
+    return rect;
+}
+
+// Desenha o estado atual: no máximo um lote por cor, nunca uma chamada por passo
+void drawVisualizer(ChessGame* game) {
+    SearchVisualizer* vis = &game->visualizer;
+    const Layout* layout = &game->layout;
+    if (!vis->active) return;
+
+    SDL_Rect open[BOARD_SIZE * BOARD_SIZE];
+    SDL_Rect closed[BOARD_SIZE * BOARD_SIZE];
+    int openCount = 0, closedCount = 0;
+
+    for (int i = 0; i < BOARD_SIZE * BOARD_SIZE; i++) {
+        if (vis->squareState[i] == SQUARE_OPEN) {
+            open[openCount++] = squareRect(layout, i, 0);
+        } else if (vis->squareState[i] == SQUARE_CLOSED) {
+            closed[closedCount++] = squareRect(layout, i, 0);
+        }
+    }
+
+    SDL_SetRenderDrawBlendMode(game->renderer, SDL_BLENDMODE_BLEND);
+    SDL_SetRenderDrawColor(game->renderer, 80, 80, 80, 110);
+    SDL_RenderFillRects(game->renderer, closed, closedCount);
+    SDL_SetRenderDrawColor(game->renderer, 0, 120, 255, 110);
+    SDL_RenderFillRects(game->renderer, open, openCount);
+
+    // Os eventos mais recentes do rastro viram contornos
+    SDL_Rect recent[VISUALIZER_TRACE_DRAWN];
+    int recentCount = 0;
+    int inset = layoutScaled(layout, 4);
+    for (long long i = vis->traceCount - 1;
+         i >= 0 && i >= vis->traceCount - VISUALIZER_TRACE_DRAWN; i--) {
+        recent[recentCount++] = squareRect(layout, vis->trace[i % VISUALIZER_TRACE_SIZE].square, inset);
+    }
+    SDL_SetRenderDrawColor(game->renderer, 255, 255, 0, 255);
+    SDL_RenderDrawRects(game->renderer, recent, recentCount);
+
+    // Melhor caminho encontrado até agora
+    if (vis->bestMoves > 0) {
+        SDL_Point points[BOARD_SIZE * BOARD_SIZE];
+        for (int i = 0; i <= vis->bestMoves; i++) {
+            SDL_Rect rect = squareRect(layout, vis->bestPath[i], 0);
+            points[i].x = rect.x + layout->squareSize / 2;
+            points[i].y = rect.y + layout->squareSize / 2;
+        }
+        SDL_SetRenderDrawColor(game->renderer, 0, 255, 0, 255);
+        SDL_RenderDrawLines(game->renderer, points, vis->bestMoves + 1);
+    }
+
+    SDL_SetRenderDrawBlendMode(game->renderer, SDL_BLENDMODE_NONE);
+}